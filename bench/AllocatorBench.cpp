@@ -0,0 +1,55 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+// Keeps a window of live ranges, every operation deletes one random range and inserts a fresh one
+template <class Allocator>
+double Churn(uint64_t live, uint64_t operations)
+{
+    UIT::Tree<uint64_t, uint64_t, Allocator> tree;
+    std::vector<uint64_t> slots(live);
+    for (uint64_t i = 0; i < live; ++i)
+    {
+        slots[i] = i;
+        uint64_t value = i;
+        tree.Insert(i * 16, i * 16 + 8, value);
+    }
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<uint64_t> dist(0, live - 1);
+    uint64_t next = live;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        uint64_t& slot = slots[dist(rng)];
+        tree.Delete(slot * 16, slot * 16 + 8);
+        slot = next++;
+        uint64_t value = slot;
+        tree.Insert(slot * 16, slot * 16 + 8, value);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / operations;
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t live = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint64_t operations = argc > 2? std::strtoull(argv[2], nullptr, 10) : 2000000;
+
+    double standard = Churn<std::allocator<UIT::Node<uint64_t, uint64_t>>>(live, operations);
+    double pool = Churn<UIT::PoolAllocator<UIT::Node<uint64_t, uint64_t>>>(live, operations);
+
+    std::cout << "live ranges: " << live << ", delete+insert pairs: " << operations << "\n";
+    std::cout << "std::allocator: " << standard << " ns/op\n";
+    std::cout << "PoolAllocator: " << pool << " ns/op\n";
+    std::cout << "speedup: " << standard / pool << "x\n";
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint64_t lookups = argc > 2? std::strtoull(argv[2], nullptr, 10) : 10000000;
+    uint64_t burst = argc > 3? std::strtoull(argv[3], nullptr, 10) : 64;
+
+    std::vector<uint64_t> order(nodes);
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(order.begin(), order.end(), rng);
+    UIT::Tree<uint64_t, uint64_t> tree;
+    for (uint64_t i : order)
+    {
+        uint64_t value = i;
+        tree.Insert(i * 16, i * 16 + 8, value);
+    }
+
+    std::vector<uint64_t> points(lookups);
+    std::uniform_int_distribution<uint64_t> dist(0, nodes * 16 - 1);
+    for (uint64_t& point : points)
+    {
+        point = dist(rng);
+    }
+    std::vector<uint64_t*> results(burst);
+
+    uint64_t found_single = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t base = 0; base + burst <= lookups; base += burst)
+    {
+        for (uint64_t i = 0; i < burst; ++i)
+        {
+            found_single += tree.Access(points[base + i], results[i]);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double single = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    uint64_t found_batch = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t base = 0; base + burst <= lookups; base += burst)
+    {
+        found_batch += tree.AccessBatch(&points[base], burst, results.data());
+    }
+    end = std::chrono::steady_clock::now();
+    double batch = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    if (found_single != found_batch)
+    {
+        std::cerr << "ERROR: single lookups found " << found_single << " but batches found " << found_batch << "\n";
+        return 1;
+    }
+    std::cout << "nodes: " << nodes << ", lookups: " << lookups << " in bursts of " << burst << "\n";
+    std::cout << "Access loop: " << single << " ns/op\n";
+    std::cout << "AccessBatch: " << batch << " ns/op\n";
+    std::cout << "speedup: " << single / batch << "x\n";
+    return 0;
+}
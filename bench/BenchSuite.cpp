@@ -0,0 +1,595 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// Reproducible workloads over the tree and two real alternatives, a std::map keyed by range start and a sorted
+// std::vector. Every size given on the command line (default 1000 100000 1000000) stores ranges [16i, 16i + 8), so
+// half of the key space misses. Reports ns/op, requested heap bytes per stored range, and last level cache misses
+// per op when the kernel lets us open a perf_event counter.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+// Live heap bytes requested through CountingAllocator, shared by every rebound copy
+std::size_t live_bytes = 0;
+
+template <class T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template <class U>
+    CountingAllocator(const CountingAllocator<U>&)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        live_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* pointer, std::size_t n)
+    {
+        live_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(pointer, n);
+    }
+};
+
+template <class T, class U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&)
+{
+    return true;
+}
+
+template <class T, class U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&)
+{
+    return false;
+}
+
+// Last level cache read misses of this thread, or nothing if perf_event is missing or not permitted
+class CacheMisses
+{
+    public:
+        CacheMisses()
+        {
+#ifdef __linux__
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.size = sizeof(attr);
+            attr.config = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            this->fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+        }
+
+        ~CacheMisses()
+        {
+#ifdef __linux__
+            if (this->fd >= 0)
+            {
+                close(this->fd);
+            }
+#endif
+        }
+
+        bool Available() const
+        {
+            return this->fd >= 0;
+        }
+
+        void Start()
+        {
+#ifdef __linux__
+            if (this->fd >= 0)
+            {
+                ioctl(this->fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        void Stop()
+        {
+#ifdef __linux__
+            if (this->fd >= 0)
+            {
+                ioctl(this->fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+#endif
+        }
+
+        // Misses counted between all Start and Stop pairs since the last Reset
+        uint64_t Count() const
+        {
+            uint64_t count = 0;
+#ifdef __linux__
+            if (this->fd >= 0 && read(this->fd, &count, sizeof(count)) != sizeof(count))
+            {
+                count = 0;
+            }
+#endif
+            return count;
+        }
+
+        void Reset()
+        {
+#ifdef __linux__
+            if (this->fd >= 0)
+            {
+                ioctl(this->fd, PERF_EVENT_IOC_RESET, 0);
+            }
+#endif
+        }
+
+    private:
+        int fd = -1;
+};
+
+// Times a section and its cache misses, sections may be entered several times before Report
+class Measurement
+{
+    public:
+        explicit Measurement(CacheMisses& misses) : misses(misses)
+        {
+            this->misses.Reset();
+        }
+
+        void Start()
+        {
+            this->misses.Start();
+            this->start = std::chrono::steady_clock::now();
+        }
+
+        void Stop(uint64_t ops)
+        {
+            auto end = std::chrono::steady_clock::now();
+            this->misses.Stop();
+            this->ns += std::chrono::duration<double, std::nano>(end - this->start).count();
+            this->ops += ops;
+        }
+
+        void Report(const char* structure, const char* workload, uint64_t size, double bytes_per_node)
+        {
+            std::printf("%-8s %-14s %11llu %10.1f", structure, workload, static_cast<unsigned long long>(size),
+                        this->ns / this->ops);
+            if (bytes_per_node > 0)
+            {
+                std::printf(" %12.1f", bytes_per_node);
+            }
+            else
+            {
+                std::printf(" %12s", "-");
+            }
+            if (this->misses.Available())
+            {
+                std::printf(" %12.2f\n", static_cast<double>(this->misses.Count()) / this->ops);
+            }
+            else
+            {
+                std::printf(" %12s\n", "n/a");
+            }
+        }
+
+    private:
+        CacheMisses& misses;
+        std::chrono::steady_clock::time_point start;
+        double ns = 0;
+        uint64_t ops = 0;
+};
+
+// The same few operations over each structure. Values are stored next to each range like in the tree.
+class TreeStructure
+{
+    public:
+        static constexpr const char* name = "Tree";
+        static constexpr bool linear_insert = false;
+
+        void Insert(uint64_t range_start, uint64_t range_end)
+        {
+            uint64_t value = range_start;
+            this->tree.Insert(range_start, range_end, value);
+        }
+
+        bool Has(uint64_t point) const
+        {
+            return this->tree.Has(point);
+        }
+
+        std::size_t Overlapping(uint64_t range_start, uint64_t range_end) const
+        {
+            return this->tree.ForEachOverlapping(range_start, range_end, [](uint64_t, uint64_t, const uint64_t&) {});
+        }
+
+        void Delete(uint64_t range_start, uint64_t range_end)
+        {
+            this->tree.Delete(range_start, range_end);
+        }
+
+        void GrowEnd(uint64_t range_start, uint64_t range_end, uint64_t new_range_end)
+        {
+            this->tree.GrowEnd(range_start, range_end, new_range_end);
+        }
+
+        void ShrinkEnd(uint64_t range_start, uint64_t range_end, uint64_t new_range_end)
+        {
+            this->tree.ShrinkEnd(range_start, range_end, new_range_end);
+        }
+
+        void GrowStart(uint64_t range_start, uint64_t range_end, uint64_t new_range_start)
+        {
+            this->tree.GrowStart(range_start, range_end, new_range_start);
+        }
+
+        void ShrinkStart(uint64_t range_start, uint64_t range_end, uint64_t new_range_start)
+        {
+            this->tree.ShrinkStart(range_start, range_end, new_range_start);
+        }
+
+    private:
+        UIT::Tree<uint64_t, uint64_t, CountingAllocator<UIT::Node<uint64_t, uint64_t>>> tree;
+};
+
+class MapStructure
+{
+    public:
+        static constexpr const char* name = "std::map";
+        static constexpr bool linear_insert = false;
+
+        void Insert(uint64_t range_start, uint64_t range_end)
+        {
+            Map::iterator next = this->map.lower_bound(range_start);
+            if ((next != this->map.end() && next->first < range_end) ||
+                (next != this->map.begin() && range_start < std::prev(next)->second.first))
+            {
+                std::abort();
+            }
+            this->map.emplace_hint(next, range_start, std::make_pair(range_end, range_start));
+        }
+
+        bool Has(uint64_t point) const
+        {
+            Map::const_iterator next = this->map.upper_bound(point);
+            return next != this->map.begin() && point < std::prev(next)->second.first;
+        }
+
+        std::size_t Overlapping(uint64_t range_start, uint64_t range_end) const
+        {
+            Map::const_iterator it = this->map.lower_bound(range_start);
+            if (it != this->map.begin() && range_start < std::prev(it)->second.first)
+            {
+                --it;
+            }
+            std::size_t visited = 0;
+            for (; it != this->map.end() && it->first < range_end; ++it)
+            {
+                ++visited;
+            }
+            return visited;
+        }
+
+        void Delete(uint64_t range_start, uint64_t)
+        {
+            this->map.erase(range_start);
+        }
+
+        void GrowEnd(uint64_t range_start, uint64_t, uint64_t new_range_end)
+        {
+            Map::iterator it = this->map.find(range_start);
+            Map::iterator next = std::next(it);
+            if (next != this->map.end() && next->first < new_range_end)
+            {
+                std::abort();
+            }
+            it->second.first = new_range_end;
+        }
+
+        void ShrinkEnd(uint64_t range_start, uint64_t, uint64_t new_range_end)
+        {
+            this->map.find(range_start)->second.first = new_range_end;
+        }
+
+        // The key changes, so the entry is erased and inserted again next to its old position
+        void GrowStart(uint64_t range_start, uint64_t, uint64_t new_range_start)
+        {
+            Map::iterator it = this->map.find(range_start);
+            if (it != this->map.begin() && new_range_start < std::prev(it)->second.first)
+            {
+                std::abort();
+            }
+            this->Rekey(it, new_range_start);
+        }
+
+        void ShrinkStart(uint64_t range_start, uint64_t, uint64_t new_range_start)
+        {
+            this->Rekey(this->map.find(range_start), new_range_start);
+        }
+
+    private:
+        using Map = std::map<uint64_t, std::pair<uint64_t, uint64_t>, std::less<uint64_t>,
+                             CountingAllocator<std::pair<const uint64_t, std::pair<uint64_t, uint64_t>>>>;
+
+        void Rekey(Map::iterator it, uint64_t new_range_start)
+        {
+            std::pair<uint64_t, uint64_t> range = it->second;
+            Map::iterator hint = this->map.erase(it);
+            this->map.emplace_hint(hint, new_range_start, range);
+        }
+
+        Map map;
+};
+
+class VectorStructure
+{
+    public:
+        static constexpr const char* name = "vector";
+        // Inserts and deletes in the middle shift the tail, the suite skips them on large sizes
+        static constexpr bool linear_insert = true;
+
+        void Insert(uint64_t range_start, uint64_t range_end)
+        {
+            Vector::iterator next = this->First(range_start);
+            if ((next != this->vector.end() && next->start < range_end) ||
+                (next != this->vector.begin() && range_start < std::prev(next)->end))
+            {
+                std::abort();
+            }
+            this->vector.insert(next, Range{range_start, range_end, range_start});
+        }
+
+        bool Has(uint64_t point) const
+        {
+            Vector::const_iterator next = std::upper_bound(this->vector.begin(), this->vector.end(), point,
+                                                           [](uint64_t point, const Range& range)
+                                                           { return point < range.start; });
+            return next != this->vector.begin() && point < std::prev(next)->end;
+        }
+
+        std::size_t Overlapping(uint64_t range_start, uint64_t range_end) const
+        {
+            Vector::const_iterator it = std::lower_bound(this->vector.begin(), this->vector.end(), range_start,
+                                                         [](const Range& range, uint64_t point)
+                                                         { return range.start < point; });
+            if (it != this->vector.begin() && range_start < std::prev(it)->end)
+            {
+                --it;
+            }
+            std::size_t visited = 0;
+            for (; it != this->vector.end() && it->start < range_end; ++it)
+            {
+                ++visited;
+            }
+            return visited;
+        }
+
+        void Delete(uint64_t range_start, uint64_t)
+        {
+            this->vector.erase(this->First(range_start));
+        }
+
+        void GrowEnd(uint64_t range_start, uint64_t, uint64_t new_range_end)
+        {
+            Vector::iterator it = this->First(range_start);
+            if (std::next(it) != this->vector.end() && std::next(it)->start < new_range_end)
+            {
+                std::abort();
+            }
+            it->end = new_range_end;
+        }
+
+        void ShrinkEnd(uint64_t range_start, uint64_t, uint64_t new_range_end)
+        {
+            this->First(range_start)->end = new_range_end;
+        }
+
+        // Ranges are disjoint, so a moved start never changes the order
+        void GrowStart(uint64_t range_start, uint64_t, uint64_t new_range_start)
+        {
+            Vector::iterator it = this->First(range_start);
+            if (it != this->vector.begin() && new_range_start < std::prev(it)->end)
+            {
+                std::abort();
+            }
+            it->start = new_range_start;
+        }
+
+        void ShrinkStart(uint64_t range_start, uint64_t, uint64_t new_range_start)
+        {
+            this->First(range_start)->start = new_range_start;
+        }
+
+    private:
+        struct Range
+        {
+            uint64_t start;
+            uint64_t end;
+            uint64_t value;
+        };
+        using Vector = std::vector<Range, CountingAllocator<Range>>;
+
+        // First range starting at or after point
+        Vector::iterator First(uint64_t point)
+        {
+            return std::lower_bound(this->vector.begin(), this->vector.end(), point,
+                                    [](const Range& range, uint64_t point) { return range.start < point; });
+        }
+
+        Vector vector;
+};
+
+// Largest size at which the sorted vector still runs its O(n) inserts and deletes
+const uint64_t linear_limit = 10000;
+
+template <class Structure>
+void Insert(const char* workload, const std::vector<uint64_t>& order, uint64_t rounds, CacheMisses& misses)
+{
+    Measurement measurement(misses);
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        // Construction and destruction stay outside of the timed section
+        std::unique_ptr<Structure> structure(new Structure());
+        measurement.Start();
+        for (uint64_t i : order)
+        {
+            structure->Insert(i * 16, i * 16 + 8);
+        }
+        measurement.Stop(order.size());
+    }
+    measurement.Report(Structure::name, workload, order.size(), 0);
+}
+
+template <class Structure>
+void Run(uint64_t size, uint64_t queries, CacheMisses& misses)
+{
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> sequential(size);
+    for (uint64_t i = 0; i < size; ++i)
+    {
+        sequential[i] = i;
+    }
+    std::vector<uint64_t> random = sequential;
+    std::shuffle(random.begin(), random.end(), rng);
+    // Small sizes are built several times so every timing covers at least about as many ops as the queries
+    uint64_t rounds = std::max<uint64_t>(1, queries / size);
+    bool linear = Structure::linear_insert && size > linear_limit;
+
+    Insert<Structure>("insert_seq", sequential, rounds, misses);
+    if (!linear)
+    {
+        Insert<Structure>("insert_random", random, rounds, misses);
+    }
+
+    // The structure the queries run on, built in random order unless that would take quadratic time
+    std::size_t before = live_bytes;
+    Structure structure;
+    for (uint64_t i : linear? sequential : random)
+    {
+        structure.Insert(i * 16, i * 16 + 8);
+    }
+    double bytes_per_node = static_cast<double>(live_bytes - before) / size;
+
+    std::vector<uint64_t> picks(queries);
+    std::uniform_int_distribution<uint64_t> dist(0, size - 1);
+    for (uint64_t& pick : picks)
+    {
+        pick = dist(rng);
+    }
+
+    uint64_t found = 0;
+    Measurement hit(misses);
+    hit.Start();
+    for (uint64_t pick : picks)
+    {
+        found += structure.Has(pick * 16 + pick % 8);
+    }
+    hit.Stop(queries);
+    hit.Report(Structure::name, "lookup_hit", size, bytes_per_node);
+
+    Measurement miss(misses);
+    miss.Start();
+    for (uint64_t pick : picks)
+    {
+        found += structure.Has(pick * 16 + 8 + pick % 8);
+    }
+    miss.Stop(queries);
+    miss.Report(Structure::name, "lookup_miss", size, bytes_per_node);
+
+    // Windows of 64 keys overlap four or five ranges
+    Measurement overlap(misses);
+    overlap.Start();
+    for (uint64_t pick : picks)
+    {
+        found += structure.Overlapping(pick * 16 + 4, pick * 16 + 68);
+    }
+    overlap.Stop(queries);
+    overlap.Report(Structure::name, "overlap_query", size, bytes_per_node);
+
+    // Both ends move out and back, so every range is in its original place after each group of four
+    Measurement resize(misses);
+    resize.Start();
+    for (uint64_t pick : picks)
+    {
+        uint64_t start = pick * 16;
+        structure.GrowEnd(start, start + 8, start + 12);
+        structure.ShrinkStart(start, start + 12, start + 4);
+        structure.GrowStart(start + 4, start + 12, start);
+        structure.ShrinkEnd(start, start + 12, start + 8);
+    }
+    resize.Stop(4 * queries);
+    resize.Report(Structure::name, "resize", size, bytes_per_node);
+
+    if (!linear)
+    {
+        Measurement churn(misses);
+        churn.Start();
+        for (uint64_t pick : picks)
+        {
+            structure.Delete(pick * 16, pick * 16 + 8);
+            structure.Insert(pick * 16, pick * 16 + 8);
+        }
+        churn.Stop(2 * queries);
+        churn.Report(Structure::name, "delete_churn", size, bytes_per_node);
+    }
+
+    if (found == 0)
+    {
+        std::printf("nothing found\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<uint64_t> sizes;
+    for (int i = 1; i < argc; ++i)
+    {
+        uint64_t size = std::strtoull(argv[i], nullptr, 10);
+        if (size == 0)
+        {
+            std::fprintf(stderr, "sizes must be positive numbers of ranges, got '%s'\n", argv[i]);
+            return 1;
+        }
+        sizes.push_back(size);
+    }
+    if (sizes.empty())
+    {
+        sizes = {1000, 100000, 1000000};
+    }
+    uint64_t queries = 1000000;
+
+    CacheMisses misses;
+    std::printf("%-8s %-14s %11s %10s %12s %12s\n", "", "workload", "ranges", "ns/op", "bytes/range", "LLC miss/op");
+    for (uint64_t size : sizes)
+    {
+        Run<TreeStructure>(size, queries, misses);
+        Run<MapStructure>(size, queries, misses);
+        Run<VectorStructure>(size, queries, misses);
+    }
+    if (!misses.Available())
+    {
+        std::printf("LLC misses need perf_event_open, see /proc/sys/kernel/perf_event_paranoid\n");
+    }
+    return 0;
+}
@@ -0,0 +1,46 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+int main(int argc, char** argv)
+{
+    uint64_t count = argc > 1? std::strtoull(argv[1], nullptr, 10) : 5000000;
+
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> ranges;
+    ranges.reserve(count);
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        ranges.emplace_back(i * 4096, i * 4096 + 1024 + i % 3072, i);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        UIT::Tree<uint64_t, uint64_t> tree;
+        for (auto& range : ranges)
+        {
+            tree.Insert(std::get<0>(range), std::get<1>(range), std::get<2>(range));
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double inserts = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::steady_clock::now();
+    {
+        UIT::Tree<uint64_t, uint64_t> tree(ranges.begin(), ranges.end());
+    }
+    end = std::chrono::steady_clock::now();
+    double bulk = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::cout << "ranges: " << count << " (load and teardown)\n";
+    std::cout << "Insert loop: " << inserts << " ms\n";
+    std::cout << "bulk load: " << bulk << " ms\n";
+    std::cout << "speedup: " << inserts / bulk << "x\n";
+    return 0;
+}
@@ -0,0 +1,111 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint64_t lookups = argc > 2? std::strtoull(argv[2], nullptr, 10) : 10000000;
+    uint64_t hot = argc > 3? std::strtoull(argv[3], nullptr, 10) : 256;
+    uint64_t churn = argc > 4? std::strtoull(argv[4], nullptr, 10) : 1000000;
+
+    std::vector<uint64_t> order(nodes);
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(order.begin(), order.end(), rng);
+    UIT::Tree<uint64_t, uint64_t> tree;
+    for (uint64_t i : order)
+    {
+        uint64_t value = i;
+        tree.Insert(i * 4096, i * 4096 + 3072, value);
+    }
+
+    // A skewed stream, 90% of the lookups land in a small set of hot regions
+    std::vector<uint64_t> hot_regions(hot);
+    for (uint64_t& region : hot_regions)
+    {
+        region = rng() % nodes;
+    }
+    std::vector<uint64_t> points(lookups);
+    for (uint64_t& p : points)
+    {
+        uint64_t region = rng() % 10? hot_regions[rng() % hot] : rng() % nodes;
+        p = region * 4096 + rng() % 4096;
+    }
+
+    uint64_t found_plain = 0;
+    uint64_t* ret;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t p : points)
+    {
+        found_plain += tree.Access(p, ret);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double plain = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+    std::cout << "nodes: " << nodes << ", lookups: " << lookups << ", hot regions: " << hot << "\n";
+    std::cout << "no cache: " << plain << " ns/op\n";
+
+    for (std::size_t entries : {64, 1024, 16384})
+    {
+        tree.EnableCache(entries, 12);
+        uint64_t found_cached = 0;
+        start = std::chrono::steady_clock::now();
+        for (uint64_t p : points)
+        {
+            found_cached += tree.Access(p, ret);
+        }
+        end = std::chrono::steady_clock::now();
+        double cached = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+        if (found_plain != found_cached)
+        {
+            std::cerr << "ERROR: plain lookups found " << found_plain << " but cached found " << found_cached << "\n";
+            return 1;
+        }
+        double hit_rate = 100.0 * tree.CacheHits() / (tree.CacheHits() + tree.CacheMisses());
+        std::cout << entries << " entries: " << cached << " ns/op, hit rate " << hit_rate << "%, speedup "
+                  << plain / cached << "x\n";
+    }
+
+    // Deleting and reinserting ranges, the cost of keeping the cache free of nodes that left the tree
+    std::vector<uint64_t> regions(churn);
+    for (uint64_t& region : regions)
+    {
+        region = rng() % nodes;
+    }
+    double uncached_churn = 0;
+    for (std::size_t entries : {0, 64, 1024, 16384})
+    {
+        tree.EnableCache(entries, 12);
+        start = std::chrono::steady_clock::now();
+        for (uint64_t region : regions)
+        {
+            uint64_t value = region;
+            tree.Delete(region * 4096, region * 4096 + 3072);
+            tree.Insert(region * 4096, region * 4096 + 3072, value);
+        }
+        end = std::chrono::steady_clock::now();
+        double churned = std::chrono::duration<double, std::nano>(end - start).count() / churn;
+        if (entries == 0)
+        {
+            uncached_churn = churned;
+            std::cout << "churn, no cache: " << churned << " ns/op\n";
+        }
+        else
+        {
+            std::cout << "churn, " << entries << " entries: " << churned << " ns/op, " << churned / uncached_churn
+                      << "x of no cache\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+using Node = UIT::Node<uint64_t, uint64_t>;
+template <class Checking>
+using Map = UIT::Tree<uint64_t, uint64_t, UIT::PoolAllocator<Node>, UIT::NoAugment, Checking>;
+
+// Inserts all ranges in a random order, then resizes and deletes them. Returns ns per modification.
+template <class Tree>
+double Churn(const std::vector<uint64_t>& order, uint64_t rounds)
+{
+    Tree tree;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t round = 0; round < rounds; ++round)
+    {
+        for (uint64_t i : order)
+        {
+            uint64_t value = i;
+            tree.Insert(i * 64, i * 64 + 32, value);
+        }
+        for (uint64_t i : order)
+        {
+            tree.GrowEnd(i * 64, i * 64 + 32, i * 64 + 48);
+            tree.ShrinkStart(i * 64, i * 64 + 48, i * 64 + 16);
+        }
+        for (uint64_t i : order)
+        {
+            tree.Delete(i * 64 + 16, i * 64 + 48);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (4 * order.size() * rounds);
+}
+
+int main(int argc, char** argv)
+{
+    // The tree is small and churned many times so it stays in cache, or the checks are buried under cache misses
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 4096;
+    uint64_t rounds = argc > 2? std::strtoull(argv[2], nullptr, 10) : 200;
+
+    std::vector<uint64_t> order(nodes);
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    // Best of a few alternating runs
+    double checked = 1e300, unchecked = 1e300;
+    for (int run = 0; run < 3; ++run)
+    {
+        checked = std::min(checked, Churn<Map<UIT::Checked>>(order, rounds));
+        unchecked = std::min(unchecked, Churn<Map<UIT::Unchecked>>(order, rounds));
+    }
+    double debug = Churn<Map<UIT::Debug>>(order, 1);
+    std::cout << "nodes: " << nodes << ", rounds: " << rounds << "\n";
+    std::cout << "Checked: " << checked << " ns/op\n";
+    std::cout << "Unchecked: " << unchecked << " ns/op\n";
+    std::cout << "Debug: " << debug << " ns/op\n";
+    std::cout << "speedup of Unchecked: " << checked / unchecked << "x\n";
+    return 0;
+}
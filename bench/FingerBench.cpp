@@ -0,0 +1,71 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Finger.hpp"
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint64_t lookups = argc > 2? std::strtoull(argv[2], nullptr, 10) : 10000000;
+
+    std::vector<uint64_t> order(nodes);
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(order.begin(), order.end(), rng);
+    UIT::Tree<uint64_t, uint64_t> tree;
+    for (uint64_t i : order)
+    {
+        uint64_t value = i;
+        tree.Insert(i * 64, i * 64 + 48, value);
+    }
+
+    // A sequential access stream, mostly stepping through a region and occasionally over a gap
+    std::vector<uint64_t> points(lookups);
+    uint64_t point = 0;
+    for (uint64_t& p : points)
+    {
+        point = (point + rng() % 16) % (nodes * 64);
+        p = point;
+    }
+
+    uint64_t found_tree = 0;
+    uint64_t* ret;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t p : points)
+    {
+        found_tree += tree.Access(p, ret);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double plain = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    uint64_t found_finger = 0;
+    UIT::Finger<UIT::Tree<uint64_t, uint64_t>> finger(tree);
+    start = std::chrono::steady_clock::now();
+    for (uint64_t p : points)
+    {
+        found_finger += finger.Access(p, ret);
+    }
+    end = std::chrono::steady_clock::now();
+    double fingered = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    if (found_tree != found_finger)
+    {
+        std::cerr << "ERROR: tree found " << found_tree << " but finger found " << found_finger << "\n";
+        return 1;
+    }
+    std::cout << "nodes: " << nodes << ", sequential lookups: " << lookups << "\n";
+    std::cout << "Tree::Access: " << plain << " ns/op\n";
+    std::cout << "Finger::Access: " << fingered << " ns/op\n";
+    std::cout << "speedup: " << plain / fingered << "x\n";
+    return 0;
+}
@@ -0,0 +1,84 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+// FindGap walks the Gaps augmentation, which the tree has to be declared with
+using GapTree = UIT::Tree<uint64_t, uint64_t, std::allocator<UIT::Node<uint64_t, uint64_t>>, UIT::Gaps<uint64_t>>;
+
+// The iterator walk FindGap replaces
+uint64_t ScanGap(const GapTree& tree, uint64_t min_size, uint64_t hint)
+{
+    uint64_t start = hint;
+    for (const auto& node : tree)
+    {
+        if (node.range_end <= start)
+        {
+            continue;
+        }
+        if (node.range_start >= start && node.range_start - start >= min_size)
+        {
+            return start;
+        }
+        start = node.range_end;
+    }
+    return start;
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 100000;
+    uint64_t lookups = argc > 2? std::strtoull(argv[2], nullptr, 10) : 1000;
+
+    // Densely packed mappings with a handful of large holes, like a long running address space
+    std::mt19937_64 rng(42);
+    GapTree tree;
+    uint64_t address = 0;
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        uint64_t value = i;
+        uint64_t size = 4096 * (1 + rng() % 16);
+        tree.Insert(address, address + size, value);
+        address += size + (rng() % 1000 == 0? 1 << 24 : 4096 * (rng() % 2));
+    }
+    std::vector<uint64_t> hints(lookups);
+    for (uint64_t& hint : hints)
+    {
+        hint = rng() % address;
+    }
+
+    uint64_t sum_scan = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t hint : hints)
+    {
+        sum_scan += ScanGap(tree, 1 << 22, hint);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double scan = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    uint64_t sum_gap = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t hint : hints)
+    {
+        sum_gap += tree.FindGap(1 << 22, hint);
+    }
+    end = std::chrono::steady_clock::now();
+    double augmented = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    if (sum_scan != sum_gap)
+    {
+        std::cerr << "ERROR: scan and FindGap disagree\n";
+        return 1;
+    }
+    std::cout << "nodes: " << nodes << ", lookups: " << lookups << "\n";
+    std::cout << "iterator scan: " << scan << " ns/op\n";
+    std::cout << "FindGap: " << augmented << " ns/op\n";
+    std::cout << "speedup: " << scan / augmented << "x\n";
+    return 0;
+}
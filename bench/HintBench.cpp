@@ -0,0 +1,45 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    // A bump allocator, every range goes right after the previous one
+    UIT::Tree<uint64_t, uint64_t> plain;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        uint64_t value = i;
+        plain.Insert(i * 64, i * 64 + 48, value);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double descent = std::chrono::duration<double, std::nano>(end - start).count() / nodes;
+
+    UIT::Tree<uint64_t, uint64_t> hinted;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        uint64_t value = i;
+        hinted.Insert(hinted.end(), i * 64, i * 64 + 48, value);
+    }
+    end = std::chrono::steady_clock::now();
+    double hint = std::chrono::duration<double, std::nano>(end - start).count() / nodes;
+
+    if (plain.size() != hinted.size())
+    {
+        std::cerr << "ERROR: trees ended up with " << plain.size() << " and " << hinted.size() << " ranges\n";
+        return 1;
+    }
+    std::cout << "monotonic inserts: " << nodes << "\n";
+    std::cout << "Insert: " << descent << " ns/op\n";
+    std::cout << "Insert with end() hint: " << hint << " ns/op\n";
+    std::cout << "speedup: " << descent / hint << "x\n";
+    return 0;
+}
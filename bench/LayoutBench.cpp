@@ -0,0 +1,144 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+using Value = std::array<uint64_t, 6>;
+using Node = UIT::Node<uint64_t, Value>;
+
+// The field order Node used before search fields were moved to the front
+struct LegacyNode
+{
+    uint64_t range_start;
+    uint64_t range_end;
+    Value range_value;
+    uint64_t max;
+    LegacyNode* parent;
+    UIT::Color color;
+    LegacyNode* left_child;
+    LegacyNode* right_child;
+};
+
+// Mirrors the tree in preorder into a contiguous array, the same order Clone() allocates from a pool
+LegacyNode* Mirror(const Node* node, LegacyNode* parent, std::vector<LegacyNode>& nodes)
+{
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+    nodes.push_back(LegacyNode());
+    LegacyNode* legacy = &nodes.back();
+    legacy->range_start = node->range_start;
+    legacy->range_end = node->range_end;
+    legacy->range_value = node->range_value;
+    legacy->max = node->max;
+    legacy->parent = parent;
+    legacy->color = node->color;
+    legacy->left_child = Mirror(node->left_child, legacy, nodes);
+    legacy->right_child = Mirror(node->right_child, legacy, nodes);
+    return legacy;
+}
+
+// Same descent as the tree's search core, optionally recording every cache line it reads
+template <class N>
+const N* Find(const N* node, uint64_t point, std::set<uintptr_t>* lines = nullptr)
+{
+    while (node)
+    {
+        if (lines)
+        {
+            lines->insert(reinterpret_cast<uintptr_t>(&node->range_start) / 64);
+            lines->insert(reinterpret_cast<uintptr_t>(&node->range_end) / 64);
+        }
+        if (point < node->range_start)
+        {
+            if (lines)
+            {
+                lines->insert(reinterpret_cast<uintptr_t>(&node->left_child) / 64);
+            }
+            node = node->left_child;
+        }
+        else if (point < node->range_end)
+        {
+            return node;
+        }
+        else
+        {
+            if (lines)
+            {
+                lines->insert(reinterpret_cast<uintptr_t>(&node->right_child) / 64);
+            }
+            node = node->right_child;
+        }
+    }
+    return nullptr;
+}
+
+template <class N>
+void Run(const char* name, const N* root, const std::vector<uint64_t>& points)
+{
+    uint64_t lines = 0;
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        std::set<uintptr_t> touched;
+        Find(root, points[i], &touched);
+        lines += touched.size();
+    }
+
+    uint64_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t point : points)
+    {
+        found += Find(root, point) != nullptr;
+    }
+    auto end = std::chrono::steady_clock::now();
+    double time = std::chrono::duration<double, std::nano>(end - start).count() / points.size();
+    std::cout << name << ": " << time << " ns/op, " << lines / 10000.0 << " cache lines/op, " << found << " hits\n";
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint64_t lookups = argc > 2? std::strtoull(argv[2], nullptr, 10) : 10000000;
+
+    std::vector<uint64_t> order(nodes);
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(order.begin(), order.end(), rng);
+    UIT::Tree<uint64_t, Value, UIT::PoolAllocator<Node>> source;
+    for (uint64_t i : order)
+    {
+        Value value = {{i, i, i, i, i, i}};
+        source.Insert(i * 16, i * 16 + 8, value);
+    }
+    // Cloning into a fresh pool lays the nodes out in preorder, Mirror does the same for the legacy layout
+    auto pooled = source.Clone();
+    std::vector<LegacyNode> legacy_nodes;
+    legacy_nodes.reserve(nodes);
+    LegacyNode* legacy_root = Mirror(pooled.root, nullptr, legacy_nodes);
+
+    std::vector<uint64_t> points(lookups);
+    std::uniform_int_distribution<uint64_t> dist(0, nodes * 16 - 1);
+    for (uint64_t& point : points)
+    {
+        point = dist(rng);
+    }
+
+    std::cout << "nodes: " << nodes << ", lookups: " << lookups << ", node size: " << sizeof(Node) <<
+                 " bytes (legacy " << sizeof(LegacyNode) << " bytes)\n";
+    Run("legacy layout", legacy_root, points);
+    Run("hot/cold layout", static_cast<const Node*>(pooled.root), points);
+    return 0;
+}
@@ -0,0 +1,89 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+// The recursive descent Tree::Access(point, node) used before the iterative search core
+template <typename K, typename V>
+bool RecursiveAccess(const K& point, UIT::Node<K, V>* node, V*& ret)
+{
+    if (node == nullptr)
+    {
+        return false;
+    }
+    if (point >= node->range_start && point < node->range_end)
+    {
+        ret = &node->range_value;
+        return true;
+    }
+    if (node->left_child && node->left_child->max > point)
+    {
+        return RecursiveAccess(point, node->left_child, ret);
+    }
+    return RecursiveAccess(point, node->right_child, ret);
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint64_t lookups = argc > 2? std::strtoull(argv[2], nullptr, 10) : 10000000;
+
+    // Ranges are [16i, 16i + 8), inserted in random order so half of the address space misses
+    std::vector<uint64_t> order(nodes);
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(order.begin(), order.end(), rng);
+    UIT::Tree<uint64_t, uint64_t> tree;
+    for (uint64_t i : order)
+    {
+        uint64_t value = i;
+        tree.Insert(i * 16, i * 16 + 8, value);
+    }
+
+    std::vector<uint64_t> points(lookups);
+    std::uniform_int_distribution<uint64_t> dist(0, nodes * 16 - 1);
+    for (uint64_t& point : points)
+    {
+        point = dist(rng);
+    }
+
+    uint64_t found = 0;
+    uint64_t* ret;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t point : points)
+    {
+        found += RecursiveAccess(point, tree.root, ret);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double recursive = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    uint64_t found_iterative = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t point : points)
+    {
+        found_iterative += tree.Access(point, ret);
+    }
+    end = std::chrono::steady_clock::now();
+    double iterative = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    if (found != found_iterative)
+    {
+        std::cerr << "ERROR: recursive found " << found << " but iterative found " << found_iterative << "\n";
+        return 1;
+    }
+    std::cout << "nodes: " << nodes << ", lookups: " << lookups << ", hits: " << found << "\n";
+    std::cout << "recursive Access: " << recursive << " ns/op\n";
+    std::cout << "iterative Access: " << iterative << " ns/op\n";
+    std::cout << "speedup: " << recursive / iterative << "x\n";
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint64_t operations = argc > 2? std::strtoull(argv[2], nullptr, 10) : 2000000;
+
+    std::vector<uint64_t> order(nodes);
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(42);
+    std::shuffle(order.begin(), order.end(), rng);
+    UIT::Tree<uint64_t, uint64_t> tree;
+    for (uint64_t i : order)
+    {
+        uint64_t value = i;
+        tree.Insert(i * 64, i * 64 + 32, value);
+    }
+    std::vector<uint64_t> targets(operations);
+    for (uint64_t& target : targets)
+    {
+        // Never the first region, so there is always room to grow downwards
+        target = 1 + rng() % (nodes - 1);
+    }
+
+    // Heap-like churn, every region grows into its gap and shrinks back
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t target : targets)
+    {
+        tree.GrowEnd(target * 64, target * 64 + 32, target * 64 + 48);
+        tree.ShrinkEnd(target * 64, target * 64 + 48, target * 64 + 32);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double resize = std::chrono::duration<double, std::nano>(end - start).count() / (2 * operations);
+
+    // Stack-like growth, every region grows downwards into its gap and shrinks back
+    start = std::chrono::steady_clock::now();
+    for (uint64_t target : targets)
+    {
+        tree.GrowStart(target * 64, target * 64 + 32, target * 64 - 16);
+        tree.ShrinkStart(target * 64 - 16, target * 64 + 32, target * 64);
+    }
+    end = std::chrono::steady_clock::now();
+    double resize_start = std::chrono::duration<double, std::nano>(end - start).count() / (2 * operations);
+
+    // Remapping, a region is deleted and inserted again
+    start = std::chrono::steady_clock::now();
+    for (uint64_t target : targets)
+    {
+        uint64_t value = target;
+        tree.Delete(target * 64, target * 64 + 32);
+        tree.Insert(target * 64, target * 64 + 32, value);
+    }
+    end = std::chrono::steady_clock::now();
+    double remap = std::chrono::duration<double, std::nano>(end - start).count() / operations;
+
+    if (tree.size() != nodes)
+    {
+        std::cerr << "ERROR: tree ended up with " << tree.size() << " ranges\n";
+        return 1;
+    }
+    std::cout << "nodes: " << nodes << ", operations: " << operations << "\n";
+    std::cout << "GrowEnd/ShrinkEnd: " << resize << " ns/op\n";
+    std::cout << "GrowStart/ShrinkStart: " << resize_start << " ns/op\n";
+    std::cout << "Delete + Insert: " << remap << " ns/op\n";
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "UniqueIntervalTree/Snapshot.hpp"
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    uint64_t lookups = argc > 2? std::strtoull(argv[2], nullptr, 10) : 10000000;
+
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> ranges;
+    ranges.reserve(nodes);
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        ranges.emplace_back(i * 16, i * 16 + 8, i);
+    }
+    UIT::Tree<uint64_t, uint64_t> tree(ranges.begin(), ranges.end());
+
+    auto start = std::chrono::steady_clock::now();
+    UIT::Snapshot<uint64_t, uint64_t> snapshot(tree);
+    auto end = std::chrono::steady_clock::now();
+    double build = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> points(lookups);
+    std::uniform_int_distribution<uint64_t> dist(0, nodes * 16 - 1);
+    for (uint64_t& point : points)
+    {
+        point = dist(rng);
+    }
+
+    uint64_t found_tree = 0;
+    const uint64_t* ret;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t point : points)
+    {
+        found_tree += tree.Access(point, ret)? *ret : 0;
+    }
+    end = std::chrono::steady_clock::now();
+    double tree_time = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    uint64_t found_snapshot = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t point : points)
+    {
+        found_snapshot += snapshot.Access(point, ret)? *ret : 0;
+    }
+    end = std::chrono::steady_clock::now();
+    double snapshot_time = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+
+    if (found_tree != found_snapshot)
+    {
+        std::cerr << "ERROR: tree and snapshot disagree\n";
+        return 1;
+    }
+    std::cout << "nodes: " << nodes << ", lookups: " << lookups << ", snapshot built in " << build << " ms\n";
+    std::cout << "Tree::Access: " << tree_time << " ns/op\n";
+    std::cout << "Snapshot::Access: " << snapshot_time << " ns/op\n";
+    std::cout << "speedup: " << tree_time / snapshot_time << "x\n";
+    return 0;
+}
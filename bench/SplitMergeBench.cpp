@@ -0,0 +1,73 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+using Map = UIT::Tree<uint64_t, uint64_t>;
+
+void Fill(Map& tree, uint64_t nodes)
+{
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        uint64_t value = i;
+        tree.Insert(i * 4096, i * 4096 + 4096, value);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 100000;
+    uint64_t operations = argc > 2? std::strtoull(argv[2], nullptr, 10) : 1000000;
+
+    // Every operation splits a random region at its middle and merges it right back, like mprotect and undo
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> regions(operations);
+    for (uint64_t& region : regions)
+    {
+        region = rng() % nodes;
+    }
+
+    Map composed;
+    Fill(composed, nodes);
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t region : regions)
+    {
+        uint64_t base = region * 4096;
+        uint64_t value = composed.Access(base);
+        composed.ShrinkEnd(base, base + 4096, base + 2048);
+        composed.Insert(base + 2048, base + 4096, value);
+        composed.Delete(base + 2048, base + 4096);
+        composed.GrowEnd(base, base + 2048, base + 4096);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double old_way = std::chrono::duration<double, std::nano>(end - start).count() / operations;
+
+    Map local;
+    Fill(local, nodes);
+    start = std::chrono::steady_clock::now();
+    for (uint64_t region : regions)
+    {
+        uint64_t base = region * 4096;
+        local.Split(base, base + 4096, base + 2048);
+        local.MergeWithNext(base, base + 2048);
+    }
+    end = std::chrono::steady_clock::now();
+    double new_way = std::chrono::duration<double, std::nano>(end - start).count() / operations;
+
+    if (composed.size() != local.size())
+    {
+        std::cerr << "ERROR: trees ended up with " << composed.size() << " and " << local.size() << " ranges\n";
+        return 1;
+    }
+    std::cout << "nodes: " << nodes << ", split and merge pairs: " << operations << "\n";
+    std::cout << "ShrinkEnd + Insert + Delete + GrowEnd: " << old_way << " ns/op\n";
+    std::cout << "Split + MergeWithNext: " << new_way << " ns/op\n";
+    std::cout << "speedup: " << old_way / new_way << "x\n";
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+int main(int argc, char** argv)
+{
+    uint64_t nodes = argc > 1? std::strtoull(argv[1], nullptr, 10) : 100000;
+    uint64_t operations = argc > 2? std::strtoull(argv[2], nullptr, 10) : 1000000;
+
+    UIT::Tree<uint64_t, uint64_t> tree;
+    for (uint64_t i = 0; i < nodes; ++i)
+    {
+        uint64_t value = i;
+        tree.Insert(i * 64, i * 64 + 32, value);
+    }
+    // Inserts that all collide with an existing range, like faults on already mapped pages
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> points(operations);
+    for (uint64_t& point : points)
+    {
+        point = (rng() % nodes) * 64 + rng() % 32;
+    }
+
+    uint64_t failed_throw = 0;
+    uint64_t value = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t point : points)
+    {
+        try
+        {
+            tree.Insert(point, point + 1, value);
+        }
+        catch (const UIT::RangeExists<uint64_t>&)
+        {
+            ++failed_throw;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double thrown = std::chrono::duration<double, std::nano>(end - start).count() / operations;
+
+    uint64_t failed_status = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint64_t point : points)
+    {
+        failed_status += tree.TryInsert(point, point + 1, value) == UIT::Status::RANGE_EXISTS;
+    }
+    end = std::chrono::steady_clock::now();
+    double status = std::chrono::duration<double, std::nano>(end - start).count() / operations;
+
+    if (failed_throw != operations || failed_status != operations)
+    {
+        std::cerr << "ERROR: expected every insert to fail\n";
+        return 1;
+    }
+    std::cout << "nodes: " << nodes << ", conflicting inserts: " << operations << "\n";
+    std::cout << "Insert + catch: " << thrown << " ns/op\n";
+    std::cout << "TryInsert: " << status << " ns/op\n";
+    std::cout << "speedup: " << thrown / status << "x\n";
+    return 0;
+}
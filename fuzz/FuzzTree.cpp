@@ -0,0 +1,26 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <cstddef>
+#include <cstdint>
+
+#include "UniqueIntervalTree/Tree.hpp"
+#include "Differential.hpp"
+
+// Same augmentations as the differential test, the harness checks order statistics through Counts
+using Augment = UIT::Join<UIT::TotalLength<uint64_t>, UIT::Counts>;
+using Node = UIT::Node<uint64_t, uint64_t, Augment>;
+using FuzzedTree = UIT::Tree<uint64_t, uint64_t, std::allocator<Node>, Augment, UIT::Debug>;
+
+// Every 7 bytes of input are one operation and its three arguments. A mismatch with the reference escapes as an
+// uncaught std::logic_error, which aborts and is reported as a crash with the offending input.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size)
+{
+    Differential<FuzzedTree> differential;
+    for (; size >= 7; data += 7, size -= 7)
+    {
+        differential.Step(data[0], data[1] | data[2] << 8, data[3] | data[4] << 8, data[5] | data[6] << 8);
+    }
+    differential.Check();
+    return 0;
+}
@@ -0,0 +1,173 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef _UNIQUEINTERVALTREE_ALLOCATORS_HPP_
+#define _UNIQUEINTERVALTREE_ALLOCATORS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "Utils.hpp"
+
+namespace UIT
+{
+    // Fixed size node pool. Nodes are carved out of cache line aligned chunks of ChunkNodes slots, freed nodes go to
+    // an intrusive free list, and the whole arena can be released at once. Copies of an allocator share the same
+    // arena, rebound copies get their own. The pool is not thread safe, use one allocator (and one tree) per thread.
+    template <class T, std::size_t ChunkNodes = 4096>
+    class PoolAllocator
+    {
+        static_assert(ChunkNodes > 0, "Chunks must hold at least one node");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+
+        public:
+            using value_type = T;
+            using propagate_on_container_copy_assignment = std::true_type;
+            using propagate_on_container_move_assignment = std::true_type;
+            using propagate_on_container_swap = std::true_type;
+
+            template <class U>
+            struct rebind
+            {
+                using other = PoolAllocator<U, ChunkNodes>;
+            };
+
+        private:
+            static constexpr std::size_t cache_line = 64;
+
+            union Slot
+            {
+                Slot* next;
+                typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+            };
+
+            struct Arena
+            {
+                std::vector<void*> chunks;
+                Slot* free_list = nullptr;
+                Slot* chunk_next = nullptr;
+                Slot* chunk_end = nullptr;
+
+                Arena() = default;
+                Arena(const Arena&) = delete;
+                Arena& operator=(const Arena&) = delete;
+
+                ~Arena()
+                {
+                    this->Release();
+                }
+
+                void Release()
+                {
+                    for (void* chunk : this->chunks)
+                    {
+                        ::operator delete(chunk);
+                    }
+                    this->chunks.clear();
+                    this->free_list = nullptr;
+                    this->chunk_next = nullptr;
+                    this->chunk_end = nullptr;
+                }
+            };
+
+            std::shared_ptr<Arena> arena;
+
+            template <class U, std::size_t N>
+            friend class PoolAllocator;
+
+        public:
+            PoolAllocator() : arena(std::make_shared<Arena>()) {}
+
+            template <class U>
+            PoolAllocator(const PoolAllocator<U, ChunkNodes>&) : arena(std::make_shared<Arena>()) {}
+
+            // Containers copied from one another (e.g. cloned trees) get their own arena
+            PoolAllocator select_on_container_copy_construction() const
+            {
+                return PoolAllocator();
+            }
+
+            T* allocate(std::size_t n)
+            {
+                if (uit_unlikely(n != 1))
+                {
+                    return static_cast<T*>(::operator new(n * sizeof(T)));
+                }
+                if (uit_unlikely(!this->arena))
+                {
+                    // Moved-from allocators start over with a fresh arena
+                    this->arena = std::make_shared<Arena>();
+                }
+                Arena& arena = *this->arena;
+                Slot* slot = arena.free_list;
+                if (slot)
+                {
+                    arena.free_list = slot->next;
+                    return reinterpret_cast<T*>(slot);
+                }
+                if (uit_unlikely(arena.chunk_next == arena.chunk_end))
+                {
+                    arena.chunks.reserve(arena.chunks.size() + 1);
+                    void* chunk = ::operator new(ChunkNodes * sizeof(Slot) + cache_line - 1);
+                    arena.chunks.push_back(chunk);
+                    // Nodes whose size is a multiple of a cache line then never straddle two lines
+                    std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(chunk) + cache_line - 1) &
+                                             ~(cache_line - 1);
+                    arena.chunk_next = reinterpret_cast<Slot*>(aligned);
+                    arena.chunk_end = arena.chunk_next + ChunkNodes;
+                }
+                return reinterpret_cast<T*>(arena.chunk_next++);
+            }
+
+            void deallocate(T* ptr, std::size_t n)
+            {
+                if (uit_unlikely(n != 1))
+                {
+                    ::operator delete(ptr);
+                    return;
+                }
+                Slot* slot = reinterpret_cast<Slot*>(ptr);
+                slot->next = this->arena->free_list;
+                this->arena->free_list = slot;
+            }
+
+            // Frees every chunk of the arena at once. Objects still living in the arena are not destroyed, and all
+            // pointers handed out by this allocator (or its copies) become dangling.
+            void Release()
+            {
+                if (this->arena)
+                {
+                    this->arena->Release();
+                }
+            }
+
+            // True if no other allocator copy shares this arena
+            bool Owned() const
+            {
+                return this->arena.use_count() == 1;
+            }
+
+            std::size_t Capacity() const
+            {
+                return this->arena? this->arena->chunks.size() * ChunkNodes : 0;
+            }
+
+            template <class U>
+            bool operator==(const PoolAllocator<U, ChunkNodes>& other) const
+            {
+                return this->arena.get() == static_cast<const void*>(other.arena.get());
+            }
+
+            template <class U>
+            bool operator!=(const PoolAllocator<U, ChunkNodes>& other) const
+            {
+                return !(*this == other);
+            }
+    };
+}
+
+#endif // _UNIQUEINTERVALTREE_ALLOCATORS_HPP_
@@ -0,0 +1,222 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef _UNIQUEINTERVALTREE_AUGMENTS_HPP_
+#define _UNIQUEINTERVALTREE_AUGMENTS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace UIT
+{
+    // Augmentation policies keep a monoid per subtree next to max, and the tree answers Reduce queries with it. A
+    // policy has a value_type, an Identity(), a Lift(range_start, range_end, range_value) for a single range, and an
+    // associative Combine(left, right) of two neighbouring runs of ranges, in that order. Join keeps two policies at
+    // once, and the tree's own queries look up the part they need with AugmentPart.
+
+    // The default, keeps nothing. Its value_type is empty so it fits in the padding of the node.
+    struct NoAugment
+    {
+        struct value_type
+        {
+        };
+
+        static value_type Identity()
+        {
+            return value_type();
+        }
+
+        template <class K, class V>
+        static value_type Lift(const K&, const K&, const V&)
+        {
+            return value_type();
+        }
+
+        static value_type Combine(const value_type&, const value_type&)
+        {
+            return value_type();
+        }
+    };
+
+    // Total length of the ranges, e.g. bytes mapped
+    template <class K>
+    struct TotalLength
+    {
+        using value_type = K;
+
+        static value_type Identity()
+        {
+            return K();
+        }
+
+        template <class V>
+        static value_type Lift(const K& range_start, const K& range_end, const V&)
+        {
+            return range_end - range_start;
+        }
+
+        static value_type Combine(const value_type& left, const value_type& right)
+        {
+            return left + right;
+        }
+    };
+
+    // Largest value, e.g. the hottest region when values are access counters. Identity is the lowest value of V.
+    template <class V>
+    struct MaxValue
+    {
+        using value_type = V;
+
+        static value_type Identity()
+        {
+            return std::numeric_limits<V>::lowest();
+        }
+
+        template <class K>
+        static value_type Lift(const K&, const K&, const V& range_value)
+        {
+            return range_value;
+        }
+
+        static value_type Combine(const value_type& left, const value_type& right)
+        {
+            return std::max(left, right);
+        }
+    };
+
+    // Lowest start, highest end and largest free space between neighbouring ranges, what FindGap needs to skip
+    // subtrees without a big enough gap. Only for arithmetic keys. The identity is the one value with max below min.
+    template <class K>
+    struct Gaps
+    {
+        static_assert(std::is_arithmetic<K>::value, "Gaps needs an arithmetic key type");
+
+        struct value_type
+        {
+            K min;
+            K max;
+            K max_gap;
+
+            bool operator==(const value_type& other) const
+            {
+                return this->min == other.min && this->max == other.max && this->max_gap == other.max_gap;
+            }
+        };
+
+        static value_type Identity()
+        {
+            return value_type{std::numeric_limits<K>::max(), std::numeric_limits<K>::lowest(), K()};
+        }
+
+        template <class V>
+        static value_type Lift(const K& range_start, const K& range_end, const V&)
+        {
+            return value_type{range_start, range_end, K()};
+        }
+
+        static value_type Combine(const value_type& left, const value_type& right)
+        {
+            if (left.max < left.min)
+            {
+                return right;
+            }
+            if (right.max < right.min)
+            {
+                return left;
+            }
+            return value_type{left.min, right.max,
+                              std::max({left.max_gap, right.max_gap, static_cast<K>(right.min - left.max)})};
+        }
+    };
+
+    // Number of ranges, what Select, Rank and CountOverlapping use to skip whole subtrees
+    struct Counts
+    {
+        using value_type = std::size_t;
+
+        static value_type Identity()
+        {
+            return 0;
+        }
+
+        template <class K, class V>
+        static value_type Lift(const K&, const K&, const V&)
+        {
+            return 1;
+        }
+
+        static value_type Combine(const value_type& left, const value_type& right)
+        {
+            return left + right;
+        }
+    };
+
+    // Both policies side by side, in first and second. Parts can be Joins themselves.
+    template <class First, class Second>
+    struct Join
+    {
+        struct value_type
+        {
+            typename First::value_type first;
+            typename Second::value_type second;
+
+            bool operator==(const value_type& other) const
+            {
+                return this->first == other.first && this->second == other.second;
+            }
+        };
+
+        static value_type Identity()
+        {
+            return value_type{First::Identity(), Second::Identity()};
+        }
+
+        template <class K, class V>
+        static value_type Lift(const K& range_start, const K& range_end, const V& range_value)
+        {
+            return value_type{First::Lift(range_start, range_end, range_value),
+                              Second::Lift(range_start, range_end, range_value)};
+        }
+
+        static value_type Combine(const value_type& left, const value_type& right)
+        {
+            return value_type{First::Combine(left.first, right.first), Second::Combine(left.second, right.second)};
+        }
+    };
+
+    // Whether Augment is Part or a Join holding it, and Get to pull Part's value out of an aggregate of Augment
+    template <class Augment, class Part>
+    struct AugmentPart : std::is_same<Augment, Part>
+    {
+        static const typename Part::value_type& Get(const typename Augment::value_type& aggregate)
+        {
+            return aggregate;
+        }
+    };
+
+    template <class First, class Second, class Part>
+    struct AugmentPart<Join<First, Second>, Part>
+        : std::integral_constant<bool, AugmentPart<First, Part>::value || AugmentPart<Second, Part>::value>
+    {
+        static const typename Part::value_type& Get(const typename Join<First, Second>::value_type& aggregate)
+        {
+            return AugmentPart<Join<First, Second>, Part>::Get(aggregate, AugmentPart<First, Part>());
+        }
+
+        static const typename Part::value_type& Get(const typename Join<First, Second>::value_type& aggregate,
+                                                    std::true_type)
+        {
+            return AugmentPart<First, Part>::Get(aggregate.first);
+        }
+
+        static const typename Part::value_type& Get(const typename Join<First, Second>::value_type& aggregate,
+                                                    std::false_type)
+        {
+            return AugmentPart<Second, Part>::Get(aggregate.second);
+        }
+    };
+}
+
+#endif // _UNIQUEINTERVALTREE_AUGMENTS_HPP_
@@ -0,0 +1,38 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef _UNIQUEINTERVALTREE_CHECKS_HPP_
+#define _UNIQUEINTERVALTREE_CHECKS_HPP_
+
+namespace UIT
+{
+    // Checking policies pick, at compile time, which validations the tree runs. arguments covers the OrderCheck of
+    // every range handed to a throwing modifier, root the cheap sanity check of the root after each modification,
+    // and verify a full Verify() of the whole tree after each modification.
+
+    // The default, validates arguments and the root
+    struct Checked
+    {
+        static constexpr bool arguments = true;
+        static constexpr bool root = true;
+        static constexpr bool verify = false;
+    };
+
+    // Trusted input in production, every check compiles away. Invalid ranges are then undefined behavior.
+    struct Unchecked
+    {
+        static constexpr bool arguments = false;
+        static constexpr bool root = false;
+        static constexpr bool verify = false;
+    };
+
+    // For tests and CI, every modification is followed by a walk of the whole tree, which makes them O(n)
+    struct Debug
+    {
+        static constexpr bool arguments = true;
+        static constexpr bool root = true;
+        static constexpr bool verify = true;
+    };
+}
+
+#endif // _UNIQUEINTERVALTREE_CHECKS_HPP_
@@ -45,6 +45,23 @@ namespace UIT
 
     template <class T>
     struct is_printable : is_printable_impl<T>::type {};
+
+    template <class T>
+    struct is_bulk_releasable_impl
+    {
+        template <class U>
+        static auto test(U*) -> decltype(std::declval<U&>().Release(),
+                                         std::declval<const U&>().Owned() == true, std::true_type());
+
+        template <class>
+        static auto test(...) -> std::false_type;
+
+        using type = decltype(test<T>(0));
+    };
+
+    // Allocators that can free everything they handed out at once, as long as no one else shares them
+    template <class T>
+    struct is_bulk_releasable : is_bulk_releasable_impl<T>::type {};
 }
 
 #endif // _UNIQUEINTERVALTREE_CONCEPTS_HPP_
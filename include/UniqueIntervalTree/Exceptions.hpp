@@ -4,6 +4,7 @@
 #ifndef _UNIQUEINTERVALTREE_EXCEPTIONS_HPP_
 #define _UNIQUEINTERVALTREE_EXCEPTIONS_HPP_
 
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <exception>
@@ -12,6 +13,17 @@
 
 namespace UIT
 {
+    // Results of the non-throwing Try* modifiers, each failure matches one of the exceptions below
+    enum class Status : uint8_t
+    {
+        SUCCESS,
+        INVALID_RANGE,
+        RANGE_NOT_FOUND,
+        RANGE_EXISTS,
+    };
+
+    // Exceptions only keep the keys when thrown and format their message on the first call to what(), so code that
+    // catches them as a matter of course never pays for the string. Formatting failures fall back to a fixed message.
     template <class K>
     class InvalidRangeException : public std::exception
     {
@@ -21,30 +33,39 @@ namespace UIT
         private:
             K range_start;
             K range_end;
-            std::string str;
+            mutable std::string str;
 
         public:
             InvalidRangeException(const K& range_start, const K& range_end)
+                : range_start(range_start), range_end(range_end)
             {
-                std::stringstream ss;
-                this->range_start = range_start;
-                this->range_end = range_end;
-                if (this->range_end < this->range_start)
-                {
-                    ss << "Range end value cannot be lower than start value: [" << this->range_start << ", " <<
-                          this->range_end << ")";
-                }
-                if (this->range_end == this->range_start)
-                {
-                    ss << "Range must start and end at different values: [" << this->range_start << ", " <<
-                          this->range_end << ")";
-                }
-                this->str = ss.str();
             }
 
             const char* what() const noexcept override
             {
-                return this->str.c_str();
+                try
+                {
+                    if (this->str.empty())
+                    {
+                        std::stringstream ss;
+                        if (this->range_end < this->range_start)
+                        {
+                            ss << "Range end value cannot be lower than start value: [" << this->range_start << ", " <<
+                                  this->range_end << ")";
+                        }
+                        if (this->range_end == this->range_start)
+                        {
+                            ss << "Range must start and end at different values: [" << this->range_start << ", " <<
+                                  this->range_end << ")";
+                        }
+                        this->str = ss.str();
+                    }
+                    return this->str.c_str();
+                }
+                catch (...)
+                {
+                    return "Invalid range";
+                }
             }
     };
 
@@ -55,20 +76,29 @@ namespace UIT
 
         private:
             K point;
-            std::string str;
+            mutable std::string str;
 
         public:
-            explicit PointNotFound(const K& point)
+            explicit PointNotFound(const K& point) : point(point)
             {
-                std::stringstream ss;
-                this->point = point;
-                ss << "Point " << this->point << " was not found in the tree";
-                this->str = ss.str();
             }
 
             const char* what() const noexcept override
             {
-                return this->str.c_str();
+                try
+                {
+                    if (this->str.empty())
+                    {
+                        std::stringstream ss;
+                        ss << "Point " << this->point << " was not found in the tree";
+                        this->str = ss.str();
+                    }
+                    return this->str.c_str();
+                }
+                catch (...)
+                {
+                    return "Point was not found in the tree";
+                }
             }
     };
 
@@ -80,21 +110,30 @@ namespace UIT
         private:
             K range_start;
             K range_end;
-            std::string str;
+            mutable std::string str;
 
         public:
-            RangeNotFound(const K& range_start, const K& range_end)
+            RangeNotFound(const K& range_start, const K& range_end) : range_start(range_start), range_end(range_end)
             {
-                std::stringstream ss;
-                this->range_start = range_start;
-                this->range_end = range_end;
-                ss << "Range [" << this->range_start << ", " << this->range_end << ") was not found in the tree";
-                this->str = ss.str();
             }
 
             const char* what() const noexcept override
             {
-                return this->str.c_str();
+                try
+                {
+                    if (this->str.empty())
+                    {
+                        std::stringstream ss;
+                        ss << "Range [" << this->range_start << ", " << this->range_end <<
+                              ") was not found in the tree";
+                        this->str = ss.str();
+                    }
+                    return this->str.c_str();
+                }
+                catch (...)
+                {
+                    return "Range was not found in the tree";
+                }
             }
     };
 
@@ -108,34 +147,90 @@ namespace UIT
             K range_end;
             K existing_range_start;
             K existing_range_end;
-            std::string str;
+            bool has_existing;
+            mutable std::string str;
 
         public:
-            RangeExists(const K& range_start, const K& range_end, const K& existing_range_start = 0,
-                        const K& existing_range_end = 0)
+            RangeExists(const K& range_start, const K& range_end)
+                : range_start(range_start), range_end(range_end), existing_range_start(range_start),
+                  existing_range_end(range_end), has_existing(false)
+            {
+            }
+
+            RangeExists(const K& range_start, const K& range_end, const K& existing_range_start,
+                        const K& existing_range_end)
+                : range_start(range_start), range_end(range_end), existing_range_start(existing_range_start),
+                  existing_range_end(existing_range_end), has_existing(true)
             {
-                std::stringstream ss;
-                this->range_start = range_start;
-                this->range_end = range_end;
-                this->existing_range_start = existing_range_start;
-                this->existing_range_end = existing_range_end;
-                if (this->existing_range_start)
+            }
+
+            const char* what() const noexcept override
+            {
+                try
                 {
-                    ss << "Range [" << this->range_start << ", " << this->range_end <<
-                          ") overlaps with existing range [" << this->existing_range_start << ", " <<
-                          this->existing_range_end << ") in the tree";
+                    if (this->str.empty())
+                    {
+                        std::stringstream ss;
+                        if (this->has_existing)
+                        {
+                            ss << "Range [" << this->range_start << ", " << this->range_end <<
+                                  ") overlaps with existing range [" << this->existing_range_start << ", " <<
+                                  this->existing_range_end << ") in the tree";
+                        }
+                        else
+                        {
+                            ss << "Range [" << this->range_start << ", " << this->range_end <<
+                                  ") overlaps with an existing range in the tree";
+                        }
+                        this->str = ss.str();
+                    }
+                    return this->str.c_str();
                 }
-                else
+                catch (...)
                 {
-                    ss << "Range [" << this->range_start << ", " << this->range_end <<
-                          ") overlaps with an existing range in the tree";
+                    return "Range overlaps with an existing range in the tree";
                 }
-                this->str = ss.str();
+            }
+    };
+
+    template <class K>
+    class UnsortedRanges : public std::exception
+    {
+        static_assert(is_printable<K>::value, "Key type must be printable");
+
+        private:
+            K range_start;
+            K range_end;
+            K previous_range_start;
+            K previous_range_end;
+            mutable std::string str;
+
+        public:
+            UnsortedRanges(const K& range_start, const K& range_end, const K& previous_range_start,
+                           const K& previous_range_end)
+                : range_start(range_start), range_end(range_end), previous_range_start(previous_range_start),
+                  previous_range_end(previous_range_end)
+            {
             }
 
             const char* what() const noexcept override
             {
-                return this->str.c_str();
+                try
+                {
+                    if (this->str.empty())
+                    {
+                        std::stringstream ss;
+                        ss << "Range [" << this->range_start << ", " << this->range_end << ") comes after range [" <<
+                              this->previous_range_start << ", " << this->previous_range_end <<
+                              ") but is not sorted after it";
+                        this->str = ss.str();
+                    }
+                    return this->str.c_str();
+                }
+                catch (...)
+                {
+                    return "Ranges are not sorted";
+                }
             }
     };
 
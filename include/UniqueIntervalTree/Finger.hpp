@@ -0,0 +1,165 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef _UNIQUEINTERVALTREE_FINGER_HPP_
+#define _UNIQUEINTERVALTREE_FINGER_HPP_
+
+#include <cstddef>
+
+#include "Utils.hpp"
+#include "Exceptions.hpp"
+#include "Tree.hpp"
+
+namespace UIT
+{
+    // Stateful lookup cursor for streams of nearby points. It remembers the last node it found and first checks it and
+    // a few of its in-order neighbours, only descending from the root when the point is further away. On sorted
+    // points this costs amortized O(1) per lookup, and points falling in the gap next to the finger are answered as
+    // misses without a descent. Removing nodes from the tree resets the finger, other changes are safe.
+    template <class T>
+    class Finger
+    {
+        private:
+            using K = typename T::key_type;
+            using V = typename T::mapped_type;
+            using N = typename T::node_type;
+
+            // Neighbours checked on each side before falling back to a root descent
+            static constexpr std::size_t steps = 4;
+
+            T* tree;
+            N* node;
+            std::size_t generation;
+
+            N* Locate(const K& point)
+            {
+                if (uit_unlikely(this->generation != this->tree->generation))
+                {
+                    this->node = nullptr;
+                    this->generation = this->tree->generation;
+                }
+                N* node = this->node;
+                if (node)
+                {
+                    if (point < node->range_start)
+                    {
+                        for (std::size_t step = 0; step < steps; ++step)
+                        {
+                            N* previous = node->Previous();
+                            if (previous == nullptr)
+                            {
+                                // Before the first range
+                                return nullptr;
+                            }
+                            node = previous;
+                            if (!(point < node->range_start))
+                            {
+                                if (point < node->range_end)
+                                {
+                                    this->node = node;
+                                    return node;
+                                }
+                                // In the gap after this node
+                                return nullptr;
+                            }
+                        }
+                    }
+                    else if (point < node->range_end)
+                    {
+                        return node;
+                    }
+                    else
+                    {
+                        for (std::size_t step = 0; step < steps; ++step)
+                        {
+                            N* next = node->Next();
+                            if (next == nullptr)
+                            {
+                                // After the last range
+                                return nullptr;
+                            }
+                            node = next;
+                            if (point < node->range_end)
+                            {
+                                if (!(point < node->range_start))
+                                {
+                                    this->node = node;
+                                    return node;
+                                }
+                                // In the gap before this node
+                                return nullptr;
+                            }
+                        }
+                    }
+                }
+                node = this->tree->Find(point);
+                if (node)
+                {
+                    this->node = node;
+                }
+                return node;
+            }
+
+        public:
+            explicit Finger(T& tree) : tree(&tree), node(nullptr), generation(tree.generation) {}
+
+            // Forget the remembered node, the next lookup descends from the root
+            void Reset()
+            {
+                this->node = nullptr;
+            }
+
+            bool Has(const K& point)
+            {
+                return this->Locate(point) != nullptr;
+            }
+
+            V& Access(const K& point)
+            {
+                N* node = this->Locate(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    throw PointNotFound<K>(point);
+                }
+                return node->range_value;
+            }
+
+            V& Access(const K& point, K& found_range_start, K& found_range_end)
+            {
+                N* node = this->Locate(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    throw PointNotFound<K>(point);
+                }
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                return node->range_value;
+            }
+
+            bool Access(const K& point, V*& ret)
+            {
+                N* node = this->Locate(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    return false;
+                }
+                ret = &node->range_value;
+                return true;
+            }
+
+            bool Access(const K& point, K& found_range_start, K& found_range_end, V*& ret)
+            {
+                N* node = this->Locate(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    return false;
+                }
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                ret = &node->range_value;
+                return true;
+            }
+    };
+}
+
+#endif // _UNIQUEINTERVALTREE_FINGER_HPP_
@@ -6,6 +6,7 @@
 
 #include <iterator>
 #include <cstddef>
+#include <type_traits>
 
 namespace UIT
 {
@@ -22,10 +23,17 @@ namespace UIT
 
         private:
             pointer ptr;
-            pointer root;
+            pointer last;
+
+            template <class U>
+            friend class Iterator;
 
         public:
-            Iterator(pointer ptr, pointer root) : ptr(ptr), root(root) {}
+            Iterator(pointer ptr, pointer last) : ptr(ptr), last(last) {}
+
+            // Mutable iterators convert to const ones
+            template <class U, typename std::enable_if<std::is_convertible<U*, T*>::value, int>::type = 0>
+            Iterator(const Iterator<U>& other) : ptr(other.ptr), last(other.last) {}
 
             reference operator*() const
             {
@@ -38,66 +46,14 @@ namespace UIT
 
             Iterator& operator++()
             {
-                if (this->ptr->right_child)
-                {
-                    // From our location, incrementing means going to the leftmost child of the right child
-                    this->ptr = this->ptr->right_child;
-                    while (this->ptr->left_child)
-                    {
-                        this->ptr = this->ptr->left_child;
-                    }
-                }
-                else
-                {
-                    // If the current location has no right child, we need to go up until we find a node that is
-                    // the left child of its parent
-                    while (this->ptr && this->ptr->IsRightChild())
-                    {
-                        this->ptr = this->ptr->parent;
-                    }
-                    if (!this->ptr)
-                    {
-                        return *this;
-                    }
-                    this->ptr = this->ptr->parent;
-                }
+                this->ptr = this->ptr->Next();
                 return *this;
             }
 
             Iterator& operator--()
             {
-                if (!this->ptr)
-                {
-                    // Initially, this starts as null. We need to go to the rightmost node in the tree
-                    this->ptr = this->root;
-                    while (this->ptr->right_child)
-                    {
-                        this->ptr = this->ptr->right_child;
-                    }
-                }
-                else if (this->ptr->left_child)
-                {
-                    // From our location, decrementing means going to the rightmost child of the left child
-                    this->ptr = this->ptr->left_child;
-                    while (this->ptr->right_child)
-                    {
-                        this->ptr = this->ptr->right_child;
-                    }
-                }
-                else
-                {
-                    // If the current location has no left child, we need to go up until we find a node that is
-                    // the right child of its parent
-                    while (this->ptr && this->ptr->IsLeftChild())
-                    {
-                        this->ptr = this->ptr->parent;
-                    }
-                    if (!this->ptr)
-                    {
-                        return *this;
-                    }
-                    this->ptr = this->ptr->parent;
-                }
+                // Decrementing end() lands on the last node, which the tree keeps track of
+                this->ptr = this->ptr? this->ptr->Previous() : this->last;
                 return *this;
             }
 
@@ -4,11 +4,13 @@
 #ifndef _UNIQUEINTERVALTREE_NODE_HPP_
 #define _UNIQUEINTERVALTREE_NODE_HPP_
 
+#include <cstddef>
 #include <cstdint>
 #include <algorithm>
 #include <sstream>
 
 #include "Concepts.hpp"
+#include "Augments.hpp"
 
 namespace UIT
 {
@@ -18,7 +20,7 @@ namespace UIT
         BLACK,
     };
 
-    template <typename K, typename V>
+    template <typename K, typename V, class Augment = NoAugment>
     class Node
     {
         static_assert(is_equality_comparable<K>::value, "Key type must be totally ordered");
@@ -28,60 +30,70 @@ namespace UIT
                       "Value type must be fundamental, or default constructible, or copy or move constructible");
 
         public:
+            // Fields are ordered by how hot they are. Lookups only read the range and the children, so those lead the
+            // node and share its first cache line; max and the links used by updates follow, and the value, which
+            // can be arbitrarily large, comes last so it never pushes the search fields apart. Without an
+            // augmentation a Node<uint64_t, uint64_t> is exactly 64 bytes, so pooled nodes, which start on line
+            // boundaries, sit in one line each. Augmentations store their aggregate before the value and make the
+            // node bigger, and then some pooled nodes start late enough in a line to split even the 32 bytes of
+            // search fields across two (3 in 8 for an 88 byte node), so only opt into the ones a tree queries.
             K range_start;
             K range_end;
-            V range_value;
+            Node* left_child;
+            Node* right_child;
             K max;
             Node* parent;
             Color color;
-            Node* left_child;
-            Node* right_child;
+            // The augmentation policy's monoid over the subtree, empty for NoAugment
+            typename Augment::value_type aggregate;
+            V range_value;
 
             // Constructor for fundamental types
             template <typename T = V>
-            Node(const K& range_start, const K& range_end, T& range_value, const K& max, Node<K, V>* parent = nullptr,
-                 Color color = Color::RED, Node<K, V>* left_child = nullptr, Node<K, V>* right_child = nullptr,
+            Node(const K& range_start, const K& range_end, T& range_value, const K& max, Node* parent = nullptr,
+                 Color color = Color::RED, Node* left_child = nullptr, Node* right_child = nullptr,
                  typename std::enable_if<std::is_fundamental<T>::value, int>::type = 0)
-                : range_start(range_start), range_end(range_end), range_value(range_value), max(max), parent(parent), color(color),
-                  left_child(left_child), right_child(right_child)
+                : range_start(range_start), range_end(range_end), left_child(left_child), right_child(right_child),
+                  max(max), parent(parent), color(color), aggregate(Augment::Identity()), range_value(range_value)
             {
             }
 
             // Constructor for moveable types
             template <typename T = V>
-            Node(const K& range_start, const K& range_end, T& range_value, const K& max, Node<K, V>* parent = nullptr,
-                 Color color = Color::RED, Node<K, V>* left_child = nullptr, Node<K, V>* right_child = nullptr,
+            Node(const K& range_start, const K& range_end, T& range_value, const K& max, Node* parent = nullptr,
+                 Color color = Color::RED, Node* left_child = nullptr, Node* right_child = nullptr,
                  typename std::enable_if<std::is_move_constructible<T>::value && !std::is_fundamental<T>::value, int>::type = 0)
-                : range_start(range_start), range_end(range_end), range_value(std::move(range_value)), max(max), parent(parent), color(color),
-                  left_child(left_child), right_child(right_child)
+                : range_start(range_start), range_end(range_end), left_child(left_child), right_child(right_child),
+                  max(max), parent(parent), color(color), aggregate(Augment::Identity()),
+                  range_value(std::move(range_value))
             {
             }
 
             // Constructor for copyable types (but not moveable)
             template <typename T = V>
-            Node(const K& range_start, const K& range_end, const T& range_value, const K& max, Node<K, V>* parent = nullptr,
-                 Color color = Color::RED, Node<K, V>* left_child = nullptr, Node<K, V>* right_child = nullptr,
+            Node(const K& range_start, const K& range_end, const T& range_value, const K& max, Node* parent = nullptr,
+                 Color color = Color::RED, Node* left_child = nullptr, Node* right_child = nullptr,
                  typename std::enable_if<std::is_copy_constructible<T>::value && !std::is_move_constructible<T>::value, int>::type = 0)
-                : range_start(range_start), range_end(range_end), range_value(range_value), max(max), parent(parent), color(color),
-                  left_child(left_child), right_child(right_child)
+                : range_start(range_start), range_end(range_end), left_child(left_child), right_child(right_child),
+                  max(max), parent(parent), color(color), aggregate(Augment::Identity()), range_value(range_value)
             {
             }
 
             // Constructor for default constructible types
             template <typename T = V>
-            Node(const K& range_start, const K& range_end, const K& max, Node<K, V>* parent = nullptr,
-                 Color color = Color::RED, Node<K, V>* left_child = nullptr, Node<K, V>* right_child = nullptr,
+            Node(const K& range_start, const K& range_end, const K& max, Node* parent = nullptr,
+                 Color color = Color::RED, Node* left_child = nullptr, Node* right_child = nullptr,
                  typename std::enable_if<std::is_default_constructible<T>::value, int>::type = 0)
-                : range_start(range_start), range_end(range_end), max(max), parent(parent), color(color),
-                  left_child(left_child), right_child(right_child)
+                : range_start(range_start), range_end(range_end), left_child(left_child), right_child(right_child),
+                  max(max), parent(parent), color(color), aggregate(Augment::Identity())
             {
             }
 
             // Delete move and copy constructors and assignment operators
-            Node(const Node<K, V>&) = delete;
-            Node(Node<K, V>&&) = delete;
-            Node<K, V>& operator=(const Node<K, V>&) = delete;
-            Node<K, V>& operator=(Node<K, V>&&) = delete;
+            Node(const Node&) = delete;
+            Node(Node&&) = delete;
+            Node& operator=(const Node&) = delete;
+            Node& operator=(Node&&) = delete;
 
             bool IsOverlapping(const K& range_start, const K& range_end) const
             {
@@ -119,7 +131,7 @@ namespace UIT
                 return this == this->parent->right_child;
             }
 
-            Node<K, V>* GetSibling() const
+            Node* GetSibling() const
             {
                 if (this->IsLeftChild())
                 {
@@ -128,6 +140,52 @@ namespace UIT
                 return this->parent->left_child;
             }
 
+            // In-order successor, nullptr for the last node
+            Node* Next() const
+            {
+                Node* node;
+                if (this->right_child)
+                {
+                    // The leftmost child of the right child
+                    node = this->right_child;
+                    while (node->left_child)
+                    {
+                        node = node->left_child;
+                    }
+                    return node;
+                }
+                // Otherwise go up until we come from a left child
+                node = const_cast<Node*>(this);
+                while (node->IsRightChild())
+                {
+                    node = node->parent;
+                }
+                return node->parent;
+            }
+
+            // In-order predecessor, nullptr for the first node
+            Node* Previous() const
+            {
+                Node* node;
+                if (this->left_child)
+                {
+                    // The rightmost child of the left child
+                    node = this->left_child;
+                    while (node->right_child)
+                    {
+                        node = node->right_child;
+                    }
+                    return node;
+                }
+                // Otherwise go up until we come from a right child
+                node = const_cast<Node*>(this);
+                while (node->IsLeftChild())
+                {
+                    node = node->parent;
+                }
+                return node->parent;
+            }
+
             void UpdateMax()
             {
                 if (this->left_child && this->right_child)
@@ -146,6 +204,10 @@ namespace UIT
                 {
                     this->max = this->range_end;
                 }
+                this->aggregate = Augment::Combine(
+                        Augment::Combine(this->left_child? this->left_child->aggregate : Augment::Identity(),
+                                         Augment::Lift(this->range_start, this->range_end, this->range_value)),
+                        this->right_child? this->right_child->aggregate : Augment::Identity());
             }
 
             std::string ToString(bool addresses) const
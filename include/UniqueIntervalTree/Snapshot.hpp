@@ -0,0 +1,148 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef _UNIQUEINTERVALTREE_SNAPSHOT_HPP_
+#define _UNIQUEINTERVALTREE_SNAPSHOT_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "Utils.hpp"
+#include "Concepts.hpp"
+#include "Exceptions.hpp"
+#include "Tree.hpp"
+
+namespace UIT
+{
+    // Immutable, contiguous copy of a tree for read-mostly phases. Range starts are stored in Eytzinger (BFS) order,
+    // so a lookup walks down an implicit tree whose top levels share cache lines, picks its direction without
+    // branching, and prefetches the descendants a few levels ahead. Changes to the source tree are not reflected,
+    // take a new snapshot instead.
+    template <typename K, typename V>
+    class Snapshot
+    {
+        static_assert(is_equality_comparable<K>::value, "Key type must be totally ordered");
+        static_assert(is_printable<K>::value, "Key type must be printable");
+        static_assert(std::is_copy_constructible<V>::value, "Value type must be copy constructible");
+
+        private:
+            // Slot 0 is unused so that the children of slot k are 2k and 2k + 1
+            std::vector<K> starts;
+            std::vector<K> ends;
+            // Values are kept in key order, ranks maps an Eytzinger slot to its value
+            std::vector<std::size_t> ranks;
+            std::vector<V> values;
+
+            // Number of slots in a cache line, prefetching slot k * stride fetches the descendants of k a few levels
+            // further down in a single line
+            static constexpr std::size_t stride = sizeof(K) < 64? 64 / sizeof(K) : 1;
+
+            template <class It>
+            void Fill(It& it, std::size_t slot, std::size_t& rank)
+            {
+                if (slot >= this->starts.size())
+                {
+                    return;
+                }
+                this->Fill(it, 2 * slot, rank);
+                this->starts[slot] = it->range_start;
+                this->ends[slot] = it->range_end;
+                this->ranks[slot] = rank++;
+                this->values.push_back(it->range_value);
+                ++it;
+                this->Fill(it, 2 * slot + 1, rank);
+            }
+
+            // Returns the slot of the range containing the point, or 0
+            std::size_t Locate(const K& point) const
+            {
+                const K* starts = this->starts.data();
+                std::size_t size = this->starts.size();
+                std::size_t slot = 1;
+                std::size_t candidate = 0;
+                while (slot < size)
+                {
+                    uit_prefetch(starts + slot * stride);
+                    // The last slot we turned right at is the greatest start not above the point
+                    bool right = !(point < starts[slot]);
+                    candidate = right? slot : candidate;
+                    slot = 2 * slot + right;
+                }
+                if (candidate && point < this->ends[candidate])
+                {
+                    return candidate;
+                }
+                return 0;
+            }
+
+        public:
+            // Built in O(n) from a single in-order walk of the tree
+            template <class Allocator, class Augment, class Checking>
+            explicit Snapshot(const Tree<K, V, Allocator, Augment, Checking>& tree)
+                : starts(tree.size() + 1), ends(tree.size() + 1), ranks(tree.size() + 1)
+            {
+                this->values.reserve(tree.size());
+                typename Tree<K, V, Allocator, Augment, Checking>::const_iterator it = tree.begin();
+                std::size_t rank = 0;
+                this->Fill(it, 1, rank);
+            }
+
+            std::size_t size() const
+            {
+                return this->values.size();
+            }
+
+            bool Has(const K& point) const
+            {
+                return this->Locate(point) != 0;
+            }
+
+            const V& Access(const K& point) const
+            {
+                std::size_t slot = this->Locate(point);
+                if (uit_unlikely(slot == 0))
+                {
+                    throw PointNotFound<K>(point);
+                }
+                return this->values[this->ranks[slot]];
+            }
+
+            const V& Access(const K& point, K& found_range_start, K& found_range_end) const
+            {
+                std::size_t slot = this->Locate(point);
+                if (uit_unlikely(slot == 0))
+                {
+                    throw PointNotFound<K>(point);
+                }
+                found_range_start = this->starts[slot];
+                found_range_end = this->ends[slot];
+                return this->values[this->ranks[slot]];
+            }
+
+            bool Access(const K& point, V const*& ret) const
+            {
+                std::size_t slot = this->Locate(point);
+                if (uit_unlikely(slot == 0))
+                {
+                    return false;
+                }
+                ret = &this->values[this->ranks[slot]];
+                return true;
+            }
+
+            bool Access(const K& point, K& found_range_start, K& found_range_end, V const*& ret) const
+            {
+                std::size_t slot = this->Locate(point);
+                if (uit_unlikely(slot == 0))
+                {
+                    return false;
+                }
+                found_range_start = this->starts[slot];
+                found_range_end = this->ends[slot];
+                ret = &this->values[this->ranks[slot]];
+                return true;
+            }
+    };
+}
+
+#endif // _UNIQUEINTERVALTREE_SNAPSHOT_HPP_
@@ -0,0 +1,143 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef _UNIQUEINTERVALTREE_STATS_HPP_
+#define _UNIQUEINTERVALTREE_STATS_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Instrumentation is only compiled in when UIT_ENABLE_STATS is defined. It changes the layout of Tree, so define it
+// for the whole program, not per translation unit. Without it uit_stat drops its argument and trees carry nothing.
+#ifdef UIT_ENABLE_STATS
+#define uit_stat(...)       __VA_ARGS__
+#else
+#define uit_stat(...)
+#endif
+
+namespace UIT
+{
+    // Operations with their own latency histogram
+    enum class Operation : uint8_t
+    {
+        INSERT,
+        DELETE,
+        LOOKUP,
+        RESIZE,
+    };
+
+    // Power of two buckets of nanoseconds, bucket i holds latencies in [2^(i - 1), 2^i) and bucket 0 the ones under
+    // a nanosecond
+    struct Histogram
+    {
+        static constexpr std::size_t buckets_count = 64;
+
+        std::array<uint64_t, buckets_count> buckets;
+
+        Histogram() : buckets()
+        {
+        }
+
+        void Record(uint64_t ns)
+        {
+            std::size_t bucket = ns? 64 - __builtin_clzll(ns) : 0;
+            ++this->buckets[bucket < buckets_count? bucket : buckets_count - 1];
+        }
+
+        uint64_t Count() const
+        {
+            uint64_t count = 0;
+            for (uint64_t bucket : this->buckets)
+            {
+                count += bucket;
+            }
+            return count;
+        }
+
+        // Upper bound in nanoseconds of the bucket holding the given quantile in [0, 1], 0 if nothing was recorded
+        uint64_t Quantile(double quantile) const
+        {
+            uint64_t count = this->Count();
+            if (count == 0)
+            {
+                return 0;
+            }
+            uint64_t rank = static_cast<uint64_t>(quantile * count);
+            uint64_t seen = 0;
+            for (std::size_t i = 0; i < buckets_count; ++i)
+            {
+                seen += this->buckets[i];
+                if (seen > rank || seen == count)
+                {
+                    return uint64_t(1) << i;
+                }
+            }
+            return 0;
+        }
+    };
+
+    // Counters and histograms of one tree, also the snapshot handed out by Tree::GetStats(). Lookups are the single
+    // point and range searches behind Access and Has, the same ones the LOOKUP histogram times, and cache_hits are the
+    // lookups the lookup cache answered without a descent. nodes_visited counts the nodes the other lookups touched,
+    // searches the tree runs for itself (FindGap, Refresh, Finger) are descents but not lookups.
+    //
+    // Const lookups update the counters of the tree, so like with the lookup cache, a tree built with UIT_ENABLE_STATS
+    // must not be read from several threads at once.
+    struct Stats
+    {
+        uint64_t descents;
+        uint64_t lookups;
+        uint64_t cache_hits;
+        uint64_t nodes_visited;
+        uint64_t rotations;
+        // Fix-up steps that recolored nodes, after an insertion and after a deletion
+        uint64_t insert_recolorings;
+        uint64_t delete_recolorings;
+        // Exceptions thrown to the caller, internal errors aside
+        uint64_t throws;
+        std::array<Histogram, 4> latencies;
+
+        Stats()
+            : descents(0), lookups(0), cache_hits(0), nodes_visited(0), rotations(0), insert_recolorings(0), delete_recolorings(0),
+              throws(0), latencies()
+        {
+        }
+
+        const Histogram& Latency(Operation operation) const
+        {
+            return this->latencies[static_cast<std::size_t>(operation)];
+        }
+
+        Histogram& Latency(Operation operation)
+        {
+            return this->latencies[static_cast<std::size_t>(operation)];
+        }
+    };
+
+    // Records the time until it goes out of scope, whether the operation returns or throws
+    class LatencyTimer
+    {
+        public:
+            explicit LatencyTimer(Histogram& histogram)
+                : histogram(histogram), start(std::chrono::steady_clock::now())
+            {
+            }
+
+            ~LatencyTimer()
+            {
+                auto end = std::chrono::steady_clock::now();
+                this->histogram.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - this->start).count());
+            }
+
+            LatencyTimer(const LatencyTimer&) = delete;
+            LatencyTimer& operator=(const LatencyTimer&) = delete;
+
+        private:
+            Histogram& histogram;
+            std::chrono::steady_clock::time_point start;
+    };
+}
+
+#endif // _UNIQUEINTERVALTREE_STATS_HPP_
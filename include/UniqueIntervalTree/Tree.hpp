@@ -4,79 +4,246 @@
 #ifndef _UNIQUEINTERVALTREE_TREE_HPP_
 #define _UNIQUEINTERVALTREE_TREE_HPP_
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "Utils.hpp"
 #include "Concepts.hpp"
 #include "Node.hpp"
+#include "Augments.hpp"
+#include "Checks.hpp"
 #include "Exceptions.hpp"
 #include "Iterators.hpp"
+#include "Allocators.hpp"
+#include "Stats.hpp"
 
 namespace UIT
 {
-    template <typename K, typename V, class Allocator = std::allocator<Node<K, V>>>
+    template <class T>
+    class Finger;
+
+    // Allocator is rebound to the node type, so it can be left at the default when using an augmentation policy.
+    // Checking is one of the policies in Checks.hpp.
+    template <typename K, typename V, class Allocator = std::allocator<Node<K, V>>, class Augment = NoAugment,
+              class Checking = Checked>
     class Tree
     {
+        friend class Finger<Tree<K, V, Allocator, Augment, Checking>>;
+
         static_assert(is_equality_comparable<K>::value, "Key type must be totally ordered");
         static_assert(is_printable<K>::value, "Key type must be printable");
         static_assert(std::is_move_constructible<V>::value || std::is_copy_constructible<V>::value ||
                       std::is_default_constructible<V>::value || std::is_fundamental<V>::value, 
                       "Value type must be fundamental, or default constructible, or copy or move constructible");
         public:
-            Allocator node_allocator;
-            Node<K, V>* root;
-
-            using iterator = Iterator<Node<K,V>>;
-            using const_iterator = Iterator<const Node<K,V>>;
+            using key_type = K;
+            using mapped_type = V;
+            using node_type = Node<K, V, Augment>;
+            using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+            using node_traits = std::allocator_traits<node_allocator_type>;
+            using aggregate_type = typename Augment::value_type;
+            using iterator = Iterator<node_type>;
+            using const_iterator = Iterator<const node_type>;
             using reverse_iterator = std::reverse_iterator<iterator>;
             using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-            Tree(const Allocator& node_allocator = Allocator()) : node_allocator(node_allocator), root(nullptr) {}
+            node_allocator_type node_allocator;
+            node_type* root;
 
-            iterator begin()
+        private:
+            // Cached on every structural change so size() and both ends of the tree are O(1)
+            std::size_t count;
+            node_type* leftmost;
+            node_type* rightmost;
+            // Bumped whenever nodes may leave the tree, so fingers know their node can no longer be trusted
+            std::size_t generation;
+            // Optional direct-mapped cache of recently found nodes for point lookups, empty when disabled
+            mutable std::vector<node_type*> cache;
+            unsigned cache_shift;
+            mutable std::size_t cache_hits;
+            mutable std::size_t cache_misses;
+            // Operation counters and latency histograms, only there when built with UIT_ENABLE_STATS. Const lookups
+            // write them, so instrumented trees must not be read from several threads at once.
+            uit_stat(mutable Stats stats;)
+
+        public:
+            Tree(const Allocator& node_allocator = Allocator())
+                : node_allocator(node_allocator), root(nullptr), count(0), leftmost(nullptr), rightmost(nullptr),
+                  generation(0), cache_shift(0), cache_hits(0), cache_misses(0) {}
+
+            // Bulk load from a random access sequence of tuple-like (range_start, range_end, value) entries, sorted by
+            // range_start and not overlapping. Values are moved out of the sequence, just like Insert does. The tree
+            // is built perfectly balanced in O(n) without a single rotation.
+            template <class RandomIt, typename std::enable_if<std::is_base_of<std::random_access_iterator_tag,
+                      typename std::iterator_traits<RandomIt>::iterator_category>::value, int>::type = 0>
+            Tree(RandomIt first, RandomIt last, const Allocator& node_allocator = Allocator())
+                : node_allocator(node_allocator), root(nullptr), count(0), leftmost(nullptr), rightmost(nullptr),
+                  generation(0), cache_shift(0), cache_hits(0), cache_misses(0)
+            {
+                std::size_t count = last - first;
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const K& range_start = std::get<0>(first[i]);
+                    const K& range_end = std::get<1>(first[i]);
+                    Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                    if (i && uit_unlikely(range_start < std::get<1>(first[i - 1])))
+                    {
+                        const K& previous_range_start = std::get<0>(first[i - 1]);
+                        const K& previous_range_end = std::get<1>(first[i - 1]);
+                        if (node_type::IsOverlapping(range_start, range_end, previous_range_start, previous_range_end))
+                        {
+                            uit_stat(++this->stats.throws;)
+                            throw RangeExists<K>(range_start, range_end, previous_range_start, previous_range_end);
+                        }
+                        uit_stat(++this->stats.throws;)
+                        throw UnsortedRanges<K>(range_start, range_end, previous_range_start, previous_range_end);
+                    }
+                }
+                if (count == 0)
+                {
+                    return;
+                }
+
+                // Levels are filled top down, so only the deepest level can be partially filled. Coloring that level
+                // red and everything above black gives every path the same black height.
+                std::size_t red_depth = 0;
+                while ((std::size_t(2) << red_depth) <= count)
+                {
+                    ++red_depth;
+                }
+                try
+                {
+                    this->Build(first, 0, count, this->root, nullptr, 0, red_depth);
+                }
+                catch (...)
+                {
+                    this->Clear();
+                    throw;
+                }
+                this->count = count;
+                this->leftmost = this->root;
+                while (this->leftmost->left_child)
+                {
+                    this->leftmost = this->leftmost->left_child;
+                }
+                this->rightmost = this->root;
+                while (this->rightmost->right_child)
+                {
+                    this->rightmost = this->rightmost->right_child;
+                }
+            }
+
+            // Trees own their nodes, copying the root pointer would free them twice
+            Tree(const Tree<K, V, Allocator, Augment, Checking>&) = delete;
+            Tree<K, V, Allocator, Augment, Checking>& operator=(
+                    const Tree<K, V, Allocator, Augment, Checking>&) = delete;
+
+            Tree(Tree<K, V, Allocator, Augment, Checking>&& other) noexcept
+                : node_allocator(std::move(other.node_allocator)), root(other.root), count(other.count),
+                  leftmost(other.leftmost), rightmost(other.rightmost), generation(0), cache(std::move(other.cache)),
+                  cache_shift(other.cache_shift), cache_hits(other.cache_hits), cache_misses(other.cache_misses)
+            {
+                uit_stat(this->stats = other.stats;)
+                other.cache.clear();
+                ++other.generation;
+                other.root = nullptr;
+                other.count = 0;
+                other.leftmost = nullptr;
+                other.rightmost = nullptr;
+            }
+
+            Tree<K, V, Allocator, Augment, Checking>& operator=(
+                    Tree<K, V, Allocator, Augment, Checking>&& other) noexcept
             {
-                Node<K, V>* node = root;
-                while (node && node->left_child)
+                if (this != &other)
                 {
-                    node = node->left_child;
+                    this->Clear();
+                    this->node_allocator = std::move(other.node_allocator);
+                    this->root = other.root;
+                    this->count = other.count;
+                    this->leftmost = other.leftmost;
+                    this->rightmost = other.rightmost;
+                    this->cache = std::move(other.cache);
+                    this->cache_shift = other.cache_shift;
+                    this->cache_hits = other.cache_hits;
+                    this->cache_misses = other.cache_misses;
+                    uit_stat(this->stats = other.stats;)
+                    other.cache.clear();
+                    ++other.generation;
+                    other.root = nullptr;
+                    other.count = 0;
+                    other.leftmost = nullptr;
+                    other.rightmost = nullptr;
                 }
-                return iterator(node, this->root);
+                return *this;
+            }
+
+            ~Tree()
+            {
+                this->Clear();
+            }
+
+            void swap(Tree<K, V, Allocator, Augment, Checking>& other) noexcept
+            {
+                using std::swap;
+                swap(this->node_allocator, other.node_allocator);
+                swap(this->root, other.root);
+                swap(this->count, other.count);
+                swap(this->leftmost, other.leftmost);
+                swap(this->rightmost, other.rightmost);
+                swap(this->cache, other.cache);
+                swap(this->cache_shift, other.cache_shift);
+                swap(this->cache_hits, other.cache_hits);
+                swap(this->cache_misses, other.cache_misses);
+                uit_stat(swap(this->stats, other.stats);)
+                ++this->generation;
+                ++other.generation;
+            }
+
+            std::size_t size() const
+            {
+                return this->count;
+            }
+
+            bool empty() const
+            {
+                return this->count == 0;
+            }
+
+            iterator begin()
+            {
+                return iterator(this->leftmost, this->rightmost);
             }
 
             iterator end()
             {
-                return iterator(nullptr, this->root);
+                return iterator(nullptr, this->rightmost);
             }
 
             const_iterator begin() const
             {
-                Node<K, V>* node = root;
-                while (node && node->left_child)
-                {
-                    node = node->left_child;
-                }
-                return const_iterator(node, this->root);
+                return const_iterator(this->leftmost, this->rightmost);
             }
 
             const_iterator end() const
             {
-                return const_iterator(nullptr, this->root);
+                return const_iterator(nullptr, this->rightmost);
             }
 
             const_iterator cbegin() const
             {
-                Node<K, V>* node = root;
-                while (node && node->left_child)
-                {
-                    node = node->left_child;
-                }
-                return const_iterator(node, this->root);
+                return const_iterator(this->leftmost, this->rightmost);
             }
 
             const_iterator cend() const
             {
-                return const_iterator(nullptr, this->root);
+                return const_iterator(nullptr, this->rightmost);
             }
 
             reverse_iterator rbegin()
@@ -110,27 +277,140 @@ namespace UIT
             }
 
         private:
-            static void OrderCheck(const K& range_start, const K& range_end)
+            static bool IsValid(const K& range_start, const K& range_end)
             {
-                if (uit_unlikely(range_end < range_start) || uit_unlikely(range_end == range_start))
+                return range_start < range_end;
+            }
+
+            void OrderCheck(const K& range_start, const K& range_end) const
+            {
+                if (Checking::arguments &&
+                    uit_unlikely((!Tree<K, V, Allocator, Augment, Checking>::IsValid(range_start, range_end))))
                 {
+                    uit_stat(++this->stats.throws;)
                     throw InvalidRangeException<K>(range_start, range_end);
                 }
             }
 
-            static void UpdateAllMax(Node<K, V>* leaf)
+            // Left children are rotated up until the current node has none, so nodes are released in key order
+            // without recursion or an explicit stack
+            template <bool Deallocate>
+            void Teardown()
+            {
+                node_type* node = this->root;
+                while (node)
+                {
+                    node_type* left = node->left_child;
+                    if (left)
+                    {
+                        node->left_child = left->right_child;
+                        left->right_child = node;
+                        node = left;
+                    }
+                    else
+                    {
+                        node_type* right = node->right_child;
+                        if (Deallocate)
+                        {
+                            this->DeallocateNode(node);
+                        }
+                        else
+                        {
+                            node_traits::destroy(this->node_allocator, node);
+                        }
+                        node = right;
+                    }
+                }
+                this->root = nullptr;
+                this->count = 0;
+                ++this->generation;
+                std::fill(this->cache.begin(), this->cache.end(), nullptr);
+                this->leftmost = nullptr;
+                this->rightmost = nullptr;
+            }
+
+            void Clear(std::true_type)
+            {
+                if (!this->node_allocator.Owned())
+                {
+                    this->Teardown<true>();
+                    return;
+                }
+                // Nothing else lives in the arena, only destructors need to run before handing it back in one go
+                if (!std::is_trivially_destructible<node_type>::value)
+                {
+                    this->Teardown<false>();
+                }
+                this->node_allocator.Release();
+                this->root = nullptr;
+                this->count = 0;
+                ++this->generation;
+                std::fill(this->cache.begin(), this->cache.end(), nullptr);
+                this->leftmost = nullptr;
+                this->rightmost = nullptr;
+            }
+
+            void Clear(std::false_type)
+            {
+                this->Teardown<true>();
+            }
+
+            // Links the middle entry of [begin, end) at slot, then both halves below it
+            template <class RandomIt>
+            void Build(RandomIt first, std::size_t begin, std::size_t end, node_type*& slot, node_type* parent,
+                       std::size_t depth, std::size_t red_depth)
+            {
+                std::size_t middle = begin + (end - begin) / 2;
+                Color color = depth && depth == red_depth? Color::RED : Color::BLACK;
+                slot = this->AllocateValueNode(std::get<0>(first[middle]), std::get<1>(first[middle]),
+                                               std::get<2>(first[middle]), std::get<1>(first[middle]), parent, color);
+                node_type* node = slot;
+                if (begin < middle)
+                {
+                    this->Build(first, begin, middle, node->left_child, node, depth + 1, red_depth);
+                }
+                if (middle + 1 < end)
+                {
+                    this->Build(first, middle + 1, end, node->right_child, node, depth + 1, red_depth);
+                }
+                node->UpdateMax();
+            }
+
+            static aggregate_type Aggregate(const node_type* node)
+            {
+                return node? node->aggregate : Augment::Identity();
+            }
+
+            // Refreshes max and the other augmentations along the path from leaf up to the root
+            static void UpdateAllMax(node_type* leaf)
+            {
+                for (; leaf; leaf = leaf->parent)
+                {
+                    leaf->UpdateMax();
+                }
+            }
+
+            // After linking a leaf, max can only grow, and stops changing at the first ancestor that already covers it
+            static void UpdateLinkedMax(node_type* leaf, std::true_type)
             {
-                leaf->UpdateMax();
-                if (leaf->parent)
+                for (node_type* ancestor = leaf->parent; ancestor && ancestor->max < leaf->range_end;
+                     ancestor = ancestor->parent)
                 {
-                    UpdateAllMax(leaf->parent);
+                    ancestor->max = leaf->range_end;
                 }
             }
 
-            Node<K, V>* RotateLeft(Node<K, V>* node)
+            // Every ancestor gains a range, so its aggregate changes even when its max does not
+            static void UpdateLinkedMax(node_type* leaf, std::false_type)
+            {
+                Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(leaf->parent);
+            }
+
+            node_type* RotateLeft(node_type* node)
             {
-                Node<K, V>* x = node->right_child;
-                Node<K, V>* y = x->left_child;
+                uit_stat(++this->stats.rotations;)
+                node_type* x = node->right_child;
+                node_type* y = x->left_child;
                 if (node->parent)
                 {
                     if (node->IsLeftChild())
@@ -160,10 +440,11 @@ namespace UIT
                 return x;
             }
 
-            Node<K, V>* RotateRight(Node<K, V>* node)
+            node_type* RotateRight(node_type* node)
             {
-                Node<K, V>* x = node->left_child;
-                Node<K, V>* y = x->right_child;
+                uit_stat(++this->stats.rotations;)
+                node_type* x = node->left_child;
+                node_type* y = x->right_child;
                 if (node->parent)
                 {
                     if (node->IsLeftChild())
@@ -193,793 +474,628 @@ namespace UIT
                 return x;
             }
 
-            // Recursive functions
-            bool Overlapping(const K& range_start, const K& range_end, const Node<K, V>* node)
+            // Iterative search core, shared by all lookups. Only the descents of the public lookups count towards
+            // nodes_visited, internal searches (FindGap, Refresh, Finger) use the uncounted overload.
+            node_type* Find(const K& point) const
             {
-                if (node == nullptr)
-                {
-                    return false;
-                }
-                if (node->IsOverlapping(range_start, range_end))
+                return this->Find(point, std::false_type());
+            }
+
+            template <class Counted>
+            node_type* Find(const K& point, Counted) const
+            {
+                uit_stat(++this->stats.descents;)
+                node_type* node = this->root;
+                while (node)
                 {
-                    return true;
+                    uit_stat(this->stats.nodes_visited += Counted::value;)
+                    if (point < node->range_start)
+                    {
+                        node = node->left_child;
+                    }
+                    else if (point < node->range_end)
+                    {
+                        return node;
+                    }
+                    else
+                    {
+                        node = node->right_child;
+                    }
                 }
-                if (node->left_child && node->left_child->max > range_start)
+                return nullptr;
+            }
+
+            // Range search behind the public Access and Has, counted as a lookup
+            node_type* Find(const K& range_start, const K& range_end) const
+            {
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::LOOKUP));)
+                uit_stat(++this->stats.descents;)
+                uit_stat(++this->stats.lookups;)
+                node_type* node = this->root;
+                while (node)
                 {
-                    return this->Overlapping(range_start, range_end, node->left_child);
+                    uit_stat(++this->stats.nodes_visited;)
+                    if (range_end <= node->range_start)
+                    {
+                        node = node->left_child;
+                    }
+                    else if (range_start >= node->range_end)
+                    {
+                        node = node->right_child;
+                    }
+                    else
+                    {
+                        return node;
+                    }
                 }
-                return this->Overlapping(range_start, range_end, node->right_child);
+                return nullptr;
             }
 
-            bool Has(const K& point, const Node<K, V>* node) const
+            // First stored range overlapping [range_start, range_end), in order. Ranges are disjoint, so all overlaps
+            // form one sorted run starting here. A left subtree whose max passes range_start holds the first range
+            // ending after range_start, anything else is pruned.
+            node_type* FindFirstOverlapping(const K& range_start, const K& range_end) const
             {
-                if (node == nullptr)
+                node_type* node = this->root;
+                while (node)
                 {
-                    return false;
+                    if (node->left_child && range_start < node->left_child->max)
+                    {
+                        node = node->left_child;
+                    }
+                    else if (range_start < node->range_end)
+                    {
+                        return node->range_start < range_end? node : nullptr;
+                    }
+                    else
+                    {
+                        node = node->right_child;
+                    }
                 }
-                if (point >= node->range_start && point < node->range_end)
+                return nullptr;
+            }
+
+            // First stored range starting at or after point, nullptr if none does.
+            node_type* FindFirstStartingFrom(const K& point) const
+            {
+                node_type* node = this->root;
+                node_type* found = nullptr;
+                while (node)
                 {
-                    return true;
+                    if (node->range_start < point)
+                    {
+                        node = node->right_child;
+                    }
+                    else
+                    {
+                        found = node;
+                        node = node->left_child;
+                    }
                 }
-                if (node->left_child && node->left_child->max > point)
+                return found;
+            }
+
+            // Left end of the first gap of at least min_size inside the subtree, which must have max_gap >= min_size
+            static K FirstGap(const node_type* node, const K& min_size)
+            {
+                using gaps = AugmentPart<Augment, Gaps<K>>;
+                while (true)
                 {
-                    return this->Has(point, node->left_child);
+                    if (node->left_child && !(gaps::Get(node->left_child->aggregate).max_gap < min_size))
+                    {
+                        node = node->left_child;
+                    }
+                    else if (node->left_child && !(node->range_start - node->left_child->max < min_size))
+                    {
+                        return node->left_child->max;
+                    }
+                    else if (node->right_child &&
+                             !(gaps::Get(node->right_child->aggregate).min - node->range_end < min_size))
+                    {
+                        return node->range_end;
+                    }
+                    else
+                    {
+                        node = node->right_child;
+                    }
                 }
-                return this->Has(point, node->right_child);
             }
 
-            bool Has(const K& range_start, const K& range_end, const Node<K, V>* node) const
+            // Number of ranges in the subtree, kept by the Counts augmentation
+            static std::size_t SubtreeCount(const node_type* node)
             {
-                if (node == nullptr)
+                return node? AugmentPart<Augment, Counts>::Get(node->aggregate) : 0;
+            }
+
+            // Number of stored ranges starting before point
+            std::size_t CountStartsBefore(const K& point) const
+            {
+                std::size_t below = 0;
+                for (const node_type* node = this->root; node;)
                 {
-                    return false;
+                    if (node->range_start < point)
+                    {
+                        below += 1 + Tree<K, V, Allocator, Augment, Checking>::SubtreeCount(node->left_child);
+                        node = node->right_child;
+                    }
+                    else
+                    {
+                        node = node->left_child;
+                    }
                 }
-                if (node->IsOverlapping(range_start, range_end))
+                return below;
+            }
+
+            // Number of stored ranges ending at or before point, ends are sorted just like starts
+            std::size_t CountEndsUpTo(const K& point) const
+            {
+                std::size_t below = 0;
+                for (const node_type* node = this->root; node;)
                 {
-                    return true;
+                    if (!(point < node->range_end))
+                    {
+                        below += 1 + Tree<K, V, Allocator, Augment, Checking>::SubtreeCount(node->left_child);
+                        node = node->right_child;
+                    }
+                    else
+                    {
+                        node = node->left_child;
+                    }
                 }
-                if (node->left_child && node->left_child->max > range_start)
+                return below;
+            }
+
+            node_type* SelectNode(std::size_t index) const
+            {
+                node_type* node = this->root;
+                while (node)
                 {
-                    return this->Has(range_start, range_end, node->left_child);
+                    std::size_t left = Tree<K, V, Allocator, Augment, Checking>::SubtreeCount(node->left_child);
+                    if (index < left)
+                    {
+                        node = node->left_child;
+                    }
+                    else if (index == left)
+                    {
+                        return node;
+                    }
+                    else
+                    {
+                        index -= left + 1;
+                        node = node->right_child;
+                    }
                 }
-                return this->Has(range_start, range_end, node->right_child);
+                return nullptr;
             }
 
-            V& Access(const K& point, Node<K, V>* node)
+            // Integral points are bucketed by point >> cache_shift, so all points of a hot region share an entry.
+            // Other keys only get a single entry, which still catches repeated lookups of the same region.
+            std::size_t CacheIndex(const K& point, std::true_type) const
             {
-                if (uit_unlikely(node == nullptr))
+                return (static_cast<std::size_t>(point) >> this->cache_shift) & (this->cache.size() - 1);
+            }
+
+            std::size_t CacheIndex(const K&, std::false_type) const
+            {
+                return 0;
+            }
+
+            // Point lookups of the public API go through the cache when it is enabled, and count as lookups whether the
+            // cache answers them or not. Hits re-check the range of the cached node, so entries stay correct across
+            // resizes, and the buckets a range gives up or a node leaves are cleared in Evict.
+            node_type* FindCached(const K& point) const
+            {
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::LOOKUP));)
+                uit_stat(++this->stats.lookups;)
+                if (uit_likely(this->cache.empty()))
                 {
-                    throw PointNotFound<K>(point);
+                    return this->Find(point, std::true_type());
                 }
-                if (point >= node->range_start && point < node->range_end)
+                node_type*& entry = this->cache[this->CacheIndex(point, std::is_integral<K>())];
+                if (entry && !(point < entry->range_start) && point < entry->range_end)
                 {
-                    return node->range_value;
+                    uit_stat(++this->stats.cache_hits;)
+                    ++this->cache_hits;
+                    return entry;
                 }
-                if (node->left_child && node->left_child->max > point)
+                ++this->cache_misses;
+                node_type* node = this->Find(point, std::true_type());
+                if (node)
                 {
-                    return this->Access(point, node->left_child);
+                    entry = node;
                 }
-                return this->Access(point, node->right_child);
+                return node;
             }
 
-            V& Access(const K& range_start, const K& range_end, Node<K, V>* node)
+            // Batched search core. Up to batch_width descents are in flight at once and advanced one level at a time in
+            // turn, prefetching the next node of each, so the cache misses of independent lookups overlap. A lane
+            // that finishes immediately starts on the next point. Callback receives the point index and its node.
+            static constexpr std::size_t batch_width = 8;
+
+            template <class Callback>
+            void FindBatch(const K* points, std::size_t count, Callback callback) const
             {
-                if (uit_unlikely(node == nullptr))
+                node_type* nodes[batch_width];
+                std::size_t indices[batch_width];
+                std::size_t active = 0;
+                std::size_t next = 0;
+                for (; active < batch_width && next < count; ++active, ++next)
                 {
-                    throw RangeNotFound<K>(range_start, range_end);
+                    nodes[active] = this->root;
+                    indices[active] = next;
                 }
-                if (node->IsOverlapping(range_start, range_end))
+                while (active)
                 {
-                    return node->range_value;
+                    for (std::size_t lane = 0; lane < active;)
+                    {
+                        node_type* node = nodes[lane];
+                        const K& point = points[indices[lane]];
+                        if (node && point < node->range_start)
+                        {
+                            node = node->left_child;
+                        }
+                        else if (node && !(point < node->range_end))
+                        {
+                            node = node->right_child;
+                        }
+                        else
+                        {
+                            callback(indices[lane], node);
+                            if (next < count)
+                            {
+                                nodes[lane] = this->root;
+                                indices[lane] = next++;
+                                ++lane;
+                            }
+                            else
+                            {
+                                --active;
+                                nodes[lane] = nodes[active];
+                                indices[lane] = indices[active];
+                            }
+                            continue;
+                        }
+                        uit_prefetch(node);
+                        nodes[lane] = node;
+                        ++lane;
+                    }
                 }
-                if (node->left_child && node->left_child->max > range_start)
+            }
+
+            // Insertion helpers, all fix-up state lives on the stack of the calling thread
+            // Sets existing to the first stored range found overlapping the new one, if any
+            node_type* FindInsertParent(const K& range_start, const K& range_end, node_type*& existing) const
+            {
+                uit_stat(++this->stats.descents;)
+                node_type* parent = nullptr;
+                node_type* node = this->root;
+                // The in-order neighbours of the new range are always on this path, so checking the path is
+                // enough to detect any overlap
+                while (node)
                 {
-                    return this->Access(range_start, range_end, node->left_child);
+                    if (uit_unlikely(node->IsOverlapping(range_start, range_end)))
+                    {
+                        existing = node;
+                        return nullptr;
+                    }
+                    parent = node;
+                    node = range_start < node->range_start? node->left_child : node->right_child;
                 }
-                return this->Access(range_start, range_end, node->right_child);
+                existing = nullptr;
+                return parent;
             }
 
-            V& Access(const K& point, Node<K, V>* node, K& found_range_start, K& found_range_end)
+            node_type* FindInsertParent(const K& range_start, const K& range_end) const
             {
-                if (uit_unlikely(node == nullptr))
+                node_type* existing;
+                node_type* parent = this->FindInsertParent(range_start, range_end, existing);
+                if (uit_unlikely(existing != nullptr))
                 {
-                    throw PointNotFound<K>(point);
+                    uit_stat(++this->stats.throws;)
+                    throw RangeExists<K>(range_start, range_end, existing->range_start, existing->range_end);
                 }
-                if (point >= node->range_start && point < node->range_end)
+                return parent;
+            }
+
+            void Link(node_type* node, node_type* parent)
+            {
+                node->parent = parent;
+                node->left_child = nullptr;
+                node->right_child = nullptr;
+                node->UpdateMax();
+                ++this->count;
+                if (uit_unlikely(parent == nullptr))
                 {
-                    found_range_start = node->range_start;
-                    found_range_end = node->range_end;
-                    return node->range_value;
+                    node->color = Color::BLACK;
+                    this->root = node;
+                    this->leftmost = node;
+                    this->rightmost = node;
+                    return;
                 }
-                if (node->left_child && node->left_child->max > point)
+                if (parent == this->leftmost && node->range_start < parent->range_start)
                 {
-                    return this->Access(point, node->left_child, found_range_start, found_range_end);
+                    this->leftmost = node;
                 }
-                return this->Access(point, node->right_child, found_range_start, found_range_end);
-            }
-
-            V& Access(const K& range_start, const K& range_end, Node<K, V>* node, K& found_range_start,
-                      K& found_range_end)
-            {
-                if (uit_unlikely(node == nullptr))
+                else if (parent == this->rightmost && node->range_start > parent->range_start)
                 {
-                    throw RangeNotFound<K>(range_start, range_end);
+                    this->rightmost = node;
                 }
-                if (node->IsOverlapping(range_start, range_end))
+                node->color = Color::RED;
+                if (node->range_start < parent->range_start)
                 {
-                    found_range_start = node->range_start;
-                    found_range_end = node->range_end;
-                    return node->range_value;
+                    parent->left_child = node;
                 }
-                if (node->left_child && node->left_child->max > range_start)
+                else
                 {
-                    return this->Access(range_start, range_end, node->left_child, found_range_start, found_range_end);
+                    parent->right_child = node;
                 }
-                return this->Access(range_start, range_end, node->right_child, found_range_start, found_range_end);
+                Tree<K, V, Allocator, Augment, Checking>::UpdateLinkedMax(node, std::is_same<Augment, NoAugment>());
+                this->InsertRecolor(node);
             }
 
-            const V& Access(const K& point, Node<K, V>* node) const
+            // Parent for a new range right before hint, like std::map::emplace_hint. If the range fits between the hint
+            // and its predecessor, it goes at the bottom of that gap in O(1): under the hint if it has no left child,
+            // else under the predecessor, which then has no right child. Otherwise this falls back to a descent.
+            node_type* FindHintParent(const_iterator hint, const K& range_start, const K& range_end) const
             {
-                if (uit_unlikely(node == nullptr))
-                {
-                    throw PointNotFound<K>(point);
-                }
-                if (point >= node->range_start && point < node->range_end)
+                node_type* next = const_cast<node_type*>(hint.operator->());
+                node_type* previous = next? next->Previous() : this->rightmost;
+                if ((next && next->range_start < range_end) || (previous && range_start < previous->range_end))
                 {
-                    return node->range_value;
+                    return this->FindInsertParent(range_start, range_end);
                 }
-                if (node->left_child && node->left_child->max > point)
+                if (next && next->left_child == nullptr)
                 {
-                    return this->Access(point, node->left_child);
+                    return next;
                 }
-                return this->Access(point, node->right_child);
+                return previous;
             }
 
-            const V& Access(const K& range_start, const K& range_end, Node<K, V>* node) const
+            // Shared by the Try resizes, direction tells whether the new bound moves the right way
+            Status TryResizeEnd(const K& range_start, const K& range_end, const K& new_range_end, bool direction)
             {
-                if (uit_unlikely(node == nullptr))
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::RESIZE));)
+                bool valid = direction && Tree<K, V, Allocator, Augment, Checking>::IsValid(range_start, range_end) &&
+                             Tree<K, V, Allocator, Augment, Checking>::IsValid(range_start, new_range_end);
+                if (uit_unlikely(!valid))
                 {
-                    throw RangeNotFound<K>(range_start, range_end);
+                    return Status::INVALID_RANGE;
                 }
-                if (node->IsOverlapping(range_start, range_end))
+                node_type* node = this->FindStored(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
                 {
-                    return node->range_value;
+                    return Status::RANGE_NOT_FOUND;
                 }
-                if (node->left_child && node->left_child->max > range_start)
+                if (uit_unlikely(this->MoveEnd(node, new_range_end) != nullptr))
                 {
-                    return this->Access(range_start, range_end, node->left_child);
+                    return Status::RANGE_EXISTS;
                 }
-                return this->Access(range_start, range_end, node->right_child);
+                this->RootCheck("Try Resize End");
+                return Status::SUCCESS;
             }
 
-            const V& Access(const K& point, Node<K, V>* node, K& found_range_start, K& found_range_end) const
+            Status TryResizeStart(const K& range_start, const K& range_end, const K& new_range_start, bool direction)
             {
-                if (uit_unlikely(node == nullptr))
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::RESIZE));)
+                bool valid = direction && Tree<K, V, Allocator, Augment, Checking>::IsValid(range_start, range_end) &&
+                             Tree<K, V, Allocator, Augment, Checking>::IsValid(new_range_start, range_end);
+                if (uit_unlikely(!valid))
                 {
-                    throw PointNotFound<K>(point);
+                    return Status::INVALID_RANGE;
                 }
-                if (point >= node->range_start && point < node->range_end)
+                node_type* node = this->FindStored(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
                 {
-                    found_range_start = node->range_start;
-                    found_range_end = node->range_end;
-                    return node->range_value;
+                    return Status::RANGE_NOT_FOUND;
                 }
-                if (node->left_child && node->left_child->max > point)
+                if (uit_unlikely(this->MoveStart(node, new_range_start) != nullptr))
                 {
-                    return this->Access(point, node->left_child, found_range_start, found_range_end);
+                    return Status::RANGE_EXISTS;
                 }
-                return this->Access(point, node->right_child, found_range_start, found_range_end);
+                this->RootCheck("Try Resize Start");
+                return Status::SUCCESS;
             }
 
-            const V& Access(const K& range_start, const K& range_end, Node<K, V>* node, K& found_range_start,
-                            K& found_range_end) const
+            // Links node right after position in order, at the bottom of position's right spine, without a descent
+            // from the root. The caller guarantees that node fits between position and its successor.
+            void LinkAfter(node_type* node, node_type* position)
             {
-                if (uit_unlikely(node == nullptr))
-                {
-                    throw RangeNotFound<K>(range_start, range_end);
-                }
-                if (node->IsOverlapping(range_start, range_end))
+                node_type* parent = position->right_child;
+                if (parent == nullptr)
                 {
-                    found_range_start = node->range_start;
-                    found_range_end = node->range_end;
-                    return node->range_value;
+                    this->Link(node, position);
+                    return;
                 }
-                if (node->left_child && node->left_child->max > range_start)
+                while (parent->left_child)
                 {
-                    return this->Access(range_start, range_end, node->left_child, found_range_start, found_range_end);
+                    parent = parent->left_child;
                 }
-                return this->Access(range_start, range_end, node->right_child, found_range_start, found_range_end);
+                this->Link(node, parent);
             }
 
-            bool Access(const K& point, Node<K, V>* node, V*& ret)
+            bool MergeWithNext(node_type* node)
             {
-                if (uit_unlikely(node == nullptr))
+                node_type* next = node->Next();
+                if (next == nullptr || !(next->range_start == node->range_end))
                 {
                     return false;
                 }
-                if (point >= node->range_start && point < node->range_end)
+                node->range_end = next->range_end;
+                // next may be node's ancestor, then deleting it does not walk over node
+                Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(node);
+                this->Delete(next);
+                return true;
+            }
+
+            // Ranges never overlap, so a new start that clears the previous range keeps the node at its in-order
+            // position. The key changes in place and only the path above it is refreshed, there is never a need to
+            // remove and reinsert the node. Returns the previous range if it is in the way, leaving node untouched.
+            node_type* MoveStart(node_type* node, const K& new_range_start)
+            {
+                if (new_range_start < node->range_start)
                 {
-                    ret = &node->range_value;
-                    return true;
+                    node_type* previous = node->Previous();
+                    if (uit_unlikely(previous != nullptr && new_range_start < previous->range_end))
+                    {
+                        return previous;
+                    }
                 }
-                if (node->left_child && node->left_child->max > point)
+                this->Evict(node, node->range_start, new_range_start);
+                node->range_start = new_range_start;
+                Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(node);
+                return nullptr;
+            }
+
+            // Same for the end, where only the next range can be in the way
+            node_type* MoveEnd(node_type* node, const K& new_range_end)
+            {
+                if (node->range_end < new_range_end)
                 {
-                    return this->Access(point, node->left_child, ret);
+                    node_type* next = node->Next();
+                    if (uit_unlikely(next != nullptr && next->range_start < new_range_end))
+                    {
+                        return next;
+                    }
                 }
-                return this->Access(point, node->right_child, ret);
+                this->Evict(node, new_range_end, node->range_end);
+                node->range_end = new_range_end;
+                Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(node);
+                return nullptr;
             }
 
-            bool Access(const K& range_start, const K& range_end, Node<K, V>* node, V*& ret)
+            // The stored range [range_start, range_end) itself, found in a single descent ordered by range_start.
+            // Returns nullptr if it is not stored.
+            node_type* FindStored(const K& range_start, const K& range_end) const
             {
-                if (uit_unlikely(node == nullptr))
+                uit_stat(++this->stats.descents;)
+                node_type* node = this->root;
+                while (node && !(node->range_start == range_start))
                 {
-                    return false;
+                    node = range_start < node->range_start? node->left_child : node->right_child;
                 }
-                if (node->IsOverlapping(range_start, range_end))
+                if (uit_unlikely(node == nullptr || !(node->range_end == range_end)))
                 {
-                    ret = &node->range_value;
-                    return true;
+                    return nullptr;
                 }
-                if (node->left_child && node->left_child->max > range_start)
-                {
-                    return this->Access(range_start, range_end, node->left_child, ret);
-                }
-                return this->Access(range_start, range_end, node->right_child, ret);
-            }
-
-            bool Access(const K& point, Node<K, V>* node, K& found_range_start, K& found_range_end, V*& ret)
-            {
-                if (uit_unlikely(node == nullptr))
-                {
-                    return false;
-                }
-                if (point >= node->range_start && point < node->range_end)
-                {
-                    found_range_start = node->range_start;
-                    found_range_end = node->range_end;
-                    ret = &node->range_value;
-                    return true;
-                }
-                if (node->left_child && node->left_child->max > point)
-                {
-                    return this->Access(point, node->left_child, found_range_start, found_range_end, ret);
-                }
-                return this->Access(point, node->right_child, found_range_start, found_range_end, ret);
-            }
-
-            bool Access(const K& range_start, const K& range_end, Node<K, V>* node, K& found_range_start,
-                        K& found_range_end, V*& ret)
-            {
-                if (uit_unlikely(node == nullptr))
-                {
-                    return false;
-                }
-                if (node->IsOverlapping(range_start, range_end))
-                {
-                    found_range_start = node->range_start;
-                    found_range_end = node->range_end;
-                    ret = &node->range_value;
-                    return true;
-                }
-                if (node->left_child && node->left_child->max > range_start)
-                {
-                    return this->Access(range_start, range_end, node->left_child, found_range_start, found_range_end, ret);
-                }
-                return this->Access(range_start, range_end, node->right_child, found_range_start, found_range_end, ret);
-            }
-
-            bool Access(const K& point, Node<K, V>* node, V const*& ret)
-            {
-                if (uit_unlikely(node == nullptr))
-                {
-                    return false;
-                }
-                if (point >= node->range_start && point < node->range_end)
-                {
-                    ret = &node->range_value;
-                    return true;
-                }
-                if (node->left_child && node->left_child->max > point)
-                {
-                    return this->Access(point, node->left_child, ret);
-                }
-                return this->Access(point, node->right_child, ret);
+                return node;
             }
 
-            bool Access(const K& range_start, const K& range_end, Node<K, V>* node, V const*& ret)
+            node_type* FindExact(const K& range_start, const K& range_end) const
             {
+                node_type* node = this->FindStored(range_start, range_end);
                 if (uit_unlikely(node == nullptr))
                 {
-                    return false;
-                }
-                if (node->IsOverlapping(range_start, range_end))
-                {
-                    ret = &node->range_value;
-                    return true;
-                }
-                if (node->left_child && node->left_child->max > range_start)
-                {
-                    return this->Access(range_start, range_end, node->left_child, ret);
+                    uit_stat(++this->stats.throws;)
+                    throw RangeNotFound<K>(range_start, range_end);
                 }
-                return this->Access(range_start, range_end, node->right_child, ret);
+                return node;
             }
 
-            bool Access(const K& point, Node<K, V>* node, K& found_range_start, K& found_range_end, V const*& ret)
+            // Bookkeeping for a node that is about to be unlinked
+            void Untrack(const node_type* node)
             {
-                if (uit_unlikely(node == nullptr))
+                --this->count;
+                ++this->generation;
+                this->Evict(node, node->range_start, node->range_end);
+                if (node == this->leftmost)
                 {
-                    return false;
+                    this->leftmost = node->Next();
                 }
-                if (point >= node->range_start && point < node->range_end)
+                if (node == this->rightmost)
                 {
-                    found_range_start = node->range_start;
-                    found_range_end = node->range_end;
-                    ret = &node->range_value;
-                    return true;
+                    this->rightmost = node->Previous();
                 }
-                if (node->left_child && node->left_child->max > point)
-                {
-                    return this->Access(point, node->left_child, found_range_start, found_range_end, ret);
-                }
-                return this->Access(point, node->right_child, found_range_start, found_range_end, ret);
             }
 
-            bool Access(const K& range_start, const K& range_end, Node<K, V>* node, K& found_range_start,
-                        K& found_range_end, V const*& ret)
+            // Clears the cache entries pointing at node in the buckets of [from, to). Entries are only ever stored in
+            // the buckets of their node's current range, so every part a range gives up goes through here, and
+            // nodes leaving the tree never need a scan of the whole cache.
+            void Evict(const node_type* node, const K& from, const K& to)
             {
-                if (uit_unlikely(node == nullptr))
+                if (uit_likely(this->cache.empty()) || !(from < to))
                 {
-                    return false;
-                }
-                if (node->IsOverlapping(range_start, range_end))
-                {
-                    found_range_start = node->range_start;
-                    found_range_end = node->range_end;
-                    ret = &node->range_value;
-                    return true;
-                }
-                if (node->left_child && node->left_child->max > range_start)
-                {
-                    return this->Access(range_start, range_end, node->left_child, found_range_start, found_range_end, ret);
+                    return;
                 }
-                return this->Access(range_start, range_end, node->right_child, found_range_start, found_range_end, ret);
+                this->Evict(node, from, to, std::is_integral<K>());
             }
 
-            Node<K, V>* Insert(const K& range_start, const K& range_end, V& value, Node<K, V>*& node, Node<K, V>* parent = nullptr)
+            void Evict(const node_type* node, const K& from, const K& to, std::true_type)
             {
-                bool conflict = false;
-                static bool left_left = false;
-                static bool left_right = false;
-                static bool right_right = false;
-                static bool right_left = false;
-
-                // Insert somewhere
-                if (node == nullptr)
-                {
-                    if (uit_unlikely(this->root == nullptr))
-                    {
-                        node = this->AllocateValueNode(range_start, range_end, value, range_end, parent, Color::BLACK);
-                    }
-                    else
-                    {
-                        node = this->AllocateValueNode(range_start, range_end, value, range_end, parent);
-                    }
-                    return node;
-                }
-
-                if (uit_unlikely(node->IsOverlapping(range_start, range_end)))
+                std::size_t first = static_cast<std::size_t>(from) >> this->cache_shift;
+                std::size_t last = static_cast<std::size_t>(to - 1) >> this->cache_shift;
+                // Past one full lap every bucket has been seen
+                std::size_t buckets = last - first < this->cache.size()? last - first + 1 : this->cache.size();
+                for (std::size_t i = 0; i < buckets; ++i)
                 {
-                    throw RangeExists<K>(range_start, range_end, node->range_start, node->range_end);
-                }
-                if (range_start < node->range_start)
-                {
-                    node->left_child = this->Insert(range_start, range_end, value, node->left_child, node);
-                    node->left_child->parent = node;
-                    if (node != this->root && node->color == Color::RED && node->left_child->color == Color::RED)
+                    node_type*& entry = this->cache[(first + i) & (this->cache.size() - 1)];
+                    if (entry == node)
                     {
-                        conflict = true;
+                        entry = nullptr;
                     }
                 }
-                else
-                {
-                    node->right_child = this->Insert(range_start, range_end, value, node->right_child, node);
-                    node->right_child->parent = node;
-                    if (node != this->root && node->color == Color::RED && node->right_child->color == Color::RED)
-                    {
-                        conflict = true;
-                    }
-                }
-
-                if (left_left)
-                {
-                    node = this->RotateLeft(node);
-                    node->color = Color::BLACK;
-                    node->left_child->color = Color::RED;
-                    left_left = false;
-                }
-                else if (right_right)
-                {
-                    node = this->RotateRight(node);
-                    node->color = Color::BLACK;
-                    node->right_child->color = Color::RED;
-                    right_right = false;
-                }
-                else if (right_left)
-                {
-                    node->right_child = this->RotateRight(node->right_child);
-                    node->right_child->parent = node;
-                    node = this->RotateLeft(node);
-                    node->color = Color::BLACK;
-                    node->left_child->color = Color::RED;
-                    right_left = false;
-                }
-                else if (left_right)
-                {
-                    node->left_child = this->RotateLeft(node->left_child);
-                    node->left_child->parent = node;
-                    node = this->RotateRight(node);
-                    node->color = Color::BLACK;
-                    node->right_child->color = Color::RED;
-                    left_right = false;
-                }
-
-                if (conflict)
-                {
-                    if(node->IsRightChild())
-                    {
-                        if(node->GetSibling() == nullptr || node->GetSibling()->color == Color::BLACK)
-                        {
-                            if(node->left_child != nullptr && node->left_child->color == Color::RED)
-                            {
-                                right_left = true;
-                            }
-                            else if(node->right_child != nullptr && node->right_child->color == Color::RED)
-                            {
-                                left_left = true;
-                            }
-                        }
-                        else
-                        {
-                            node->GetSibling()->color = Color::BLACK;
-                            node->color = Color::BLACK;
-                            if(node->parent != this->root)
-                            {
-                                node->parent->color = Color::RED;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        if(node->GetSibling() == nullptr || node->GetSibling()->color == Color::BLACK)
-                        {
-                            if(node->left_child != nullptr && node->left_child->color == Color::RED)
-                            {
-                                right_right = true;
-                            }
-                            else if(node->right_child != nullptr && node->right_child->color == Color::RED)
-                            {
-                                left_right = true;
-                            }
-                        }
-                        else
-                        {
-                            node->GetSibling()->color = Color::BLACK;
-                            node->color = Color::BLACK;
-                            if(node->parent != this->root)
-                            {
-                                node->parent->color = Color::RED;
-                            }
-                        }
-                    }
-                }
-
-                // Update max
-                node->UpdateMax();
-
-                return node;
             }
 
-            Node<K, V>* Insert(const K& range_start, const K& range_end, Node<K, V>*& node, Node<K, V>* parent = nullptr)
+            void Evict(const node_type* node, const K&, const K&, std::false_type)
             {
-                bool conflict = false;
-                static bool left_left = false;
-                static bool left_right = false;
-                static bool right_right = false;
-                static bool right_left = false;
-
-                // Insert somewhere
-                if (node == nullptr)
-                {
-                    if (uit_unlikely(this->root == nullptr))
-                    {
-                        node = this->AllocateEmptyNode(range_start, range_end, range_end, parent, Color::BLACK);
-                    }
-                    else
-                    {
-                        node = this->AllocateEmptyNode(range_start, range_end, range_end, parent);
-                    }
-                    return node;
-                }
-
-                if (uit_unlikely(node->IsOverlapping(range_start, range_end)))
-                {
-                    throw RangeExists<K>(range_start, range_end, node->range_start, node->range_end);
-                }
-                if (range_start < node->range_start)
-                {
-                    node->left_child = this->Insert(range_start, range_end, node->left_child, node);
-                    node->left_child->parent = node;
-                    if (node != this->root && node->color == Color::RED && node->left_child->color == Color::RED)
-                    {
-                        conflict = true;
-                    }
-                }
-                else
-                {
-                    node->right_child = this->Insert(range_start, range_end, node->right_child, node);
-                    node->right_child->parent = node;
-                    if (node != this->root && node->color == Color::RED && node->right_child->color == Color::RED)
-                    {
-                        conflict = true;
-                    }
-                }
-
-                if (left_left)
+                if (this->cache[0] == node)
                 {
-                    node = this->RotateLeft(node);
-                    node->color = Color::BLACK;
-                    node->left_child->color = Color::RED;
-                    left_left = false;
-                }
-                else if (right_right)
-                {
-                    node = this->RotateRight(node);
-                    node->color = Color::BLACK;
-                    node->right_child->color = Color::RED;
-                    right_right = false;
-                }
-                else if (right_left)
-                {
-                    node->right_child = this->RotateRight(node->right_child);
-                    node->right_child->parent = node;
-                    node = this->RotateLeft(node);
-                    node->color = Color::BLACK;
-                    node->left_child->color = Color::RED;
-                    right_left = false;
+                    this->cache[0] = nullptr;
                 }
-                else if (left_right)
-                {
-                    node->left_child = this->RotateLeft(node->left_child);
-                    node->left_child->parent = node;
-                    node = this->RotateRight(node);
-                    node->color = Color::BLACK;
-                    node->right_child->color = Color::RED;
-                    left_right = false;
-                }
-
-                if (conflict)
-                {
-                    if(node->IsRightChild())
-                    {
-                        if(node->GetSibling() == nullptr || node->GetSibling()->color == Color::BLACK)
-                        {
-                            if(node->left_child != nullptr && node->left_child->color == Color::RED)
-                            {
-                                right_left = true;
-                            }
-                            else if(node->right_child != nullptr && node->right_child->color == Color::RED)
-                            {
-                                left_left = true;
-                            }
-                        }
-                        else
-                        {
-                            node->GetSibling()->color = Color::BLACK;
-                            node->color = Color::BLACK;
-                            if(node->parent != this->root)
-                            {
-                                node->parent->color = Color::RED;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        if(node->GetSibling() == nullptr || node->GetSibling()->color == Color::BLACK)
-                        {
-                            if(node->left_child != nullptr && node->left_child->color == Color::RED)
-                            {
-                                right_right = true;
-                            }
-                            else if(node->right_child != nullptr && node->right_child->color == Color::RED)
-                            {
-                                left_right = true;
-                            }
-                        }
-                        else
-                        {
-                            node->GetSibling()->color = Color::BLACK;
-                            node->color = Color::BLACK;
-                            if(node->parent != this->root)
-                            {
-                                node->parent->color = Color::RED;
-                            }
-                        }
-                    }
-                }
-
-                // Update max
-                node->UpdateMax();
-
-                return node;
             }
 
-            Node<K, V>* Insert(Node<K, V>* insert_node, Node<K, V>*& node, Node<K, V>* parent = nullptr)
+            void InsertRecolor(node_type* node)
             {
-                bool conflict = false;
-                static bool left_left = false;
-                static bool left_right = false;
-                static bool right_right = false;
-                static bool right_left = false;
-
-                // Insert somewhere
-                if (node == nullptr)
+                while (node != this->root && node->parent->color == Color::RED)
                 {
-                    insert_node->parent = parent;
-                    if (uit_unlikely(this->root == nullptr))
+                    // A red parent is never the root, so the grandparent exists
+                    node_type* parent = node->parent;
+                    node_type* grandparent = parent->parent;
+                    node_type* uncle = parent->GetSibling();
+                    if (uncle && uncle->color == Color::RED)
                     {
-                        insert_node->color = Color::BLACK;
+                        uit_stat(++this->stats.insert_recolorings;)
+                        parent->color = Color::BLACK;
+                        uncle->color = Color::BLACK;
+                        grandparent->color = Color::RED;
+                        node = grandparent;
+                        continue;
                     }
-                    else
-                    {
-                        insert_node->color = Color::RED;
-                    }
-                    node = insert_node;
-                    return node;
-                }
-
-                if (uit_unlikely(node->IsOverlapping(insert_node->range_start, insert_node->range_end)))
-                {
-                    throw RangeExists<K>(insert_node->range_start, insert_node->range_end, node->range_start,
-                                         node->range_end);
-                }
-                if (insert_node->range_start < node->range_start)
-                {
-                    node->left_child = this->Insert(insert_node, node->left_child, node);
-                    node->left_child->parent = node;
-                    if (node != this->root && node->color == Color::RED && node->left_child->color == Color::RED)
-                    {
-                        conflict = true;
-                    }
-                }
-                else
-                {
-                    node->right_child = this->Insert(insert_node, node->right_child, node);
-                    node->right_child->parent = node;
-                    if (node != this->root && node->color == Color::RED && node->right_child->color == Color::RED)
-                    {
-                        conflict = true;
-                    }
-                }
-
-                if (left_left)
-                {
-                    node = this->RotateLeft(node);
-                    node->color = Color::BLACK;
-                    node->left_child->color = Color::RED;
-                    left_left = false;
-                }
-                else if (right_right)
-                {
-                    node = this->RotateRight(node);
-                    node->color = Color::BLACK;
-                    node->right_child->color = Color::RED;
-                    right_right = false;
-                }
-                else if (right_left)
-                {
-                    node->right_child = this->RotateRight(node->right_child);
-                    node->right_child->parent = node;
-                    node = this->RotateLeft(node);
-                    node->color = Color::BLACK;
-                    node->left_child->color = Color::RED;
-                    right_left = false;
-                }
-                else if (left_right)
-                {
-                    node->left_child = this->RotateLeft(node->left_child);
-                    node->left_child->parent = node;
-                    node = this->RotateRight(node);
-                    node->color = Color::BLACK;
-                    node->right_child->color = Color::RED;
-                    left_right = false;
-                }
-
-                if (conflict)
-                {
-                    if(node->IsRightChild())
+                    if (parent->IsLeftChild())
                     {
-                        if(node->GetSibling() == nullptr || node->GetSibling()->color == Color::BLACK)
-                        {
-                            if(node->left_child != nullptr && node->left_child->color == Color::RED)
-                            {
-                                right_left = true;
-                            }
-                            else if(node->right_child != nullptr && node->right_child->color == Color::RED)
-                            {
-                                left_left = true;
-                            }
-                        }
-                        else
+                        if (node->IsRightChild())
                         {
-                            node->GetSibling()->color = Color::BLACK;
-                            node->color = Color::BLACK;
-                            if(node->parent != this->root)
-                            {
-                                node->parent->color = Color::RED;
-                            }
+                            this->RotateLeft(parent);
+                            parent = node;
                         }
+                        this->RotateRight(grandparent);
                     }
                     else
                     {
-                        if(node->GetSibling() == nullptr || node->GetSibling()->color == Color::BLACK)
-                        {
-                            if(node->left_child != nullptr && node->left_child->color == Color::RED)
-                            {
-                                right_right = true;
-                            }
-                            else if(node->right_child != nullptr && node->right_child->color == Color::RED)
-                            {
-                                left_right = true;
-                            }
-                        }
-                        else
+                        if (node->IsLeftChild())
                         {
-                            node->GetSibling()->color = Color::BLACK;
-                            node->color = Color::BLACK;
-                            if(node->parent != this->root)
-                            {
-                                node->parent->color = Color::RED;
-                            }
+                            this->RotateRight(parent);
+                            parent = node;
                         }
+                        this->RotateLeft(grandparent);
                     }
+                    parent->color = Color::BLACK;
+                    grandparent->color = Color::RED;
+                    break;
                 }
-
-                // Update max
-                node->UpdateMax();
-
-                return node;
-            }
-
-            void GrowEnd(const K& range_start, const K& range_end, const K& new_range_end, Node<K, V>* node)
-            {
-                if (uit_unlikely(node == nullptr))
-                {
-                    throw RangeNotFound<K>(range_start, range_end);
-                }
-                if (node->IsSame(range_start, range_end))
-                {
-                    node->range_end = new_range_end;
-                }
-                else if (node->left_child && node->left_child->max > range_start)
-                {
-                    this->GrowEnd(range_start, range_end, new_range_end, node->left_child);
-                }
-                else
-                {
-                    this->GrowEnd(range_start, range_end, new_range_end, node->right_child);
-                }
-                node->UpdateMax();
+                this->root->color = Color::BLACK;
             }
 
-            void RemoveRecolor(Node<K, V>* node)
+            // Recursive functions
+            void RemoveRecolor(node_type* node)
             {
                 if (node == this->root)
                 {
                     return;
                 }
+                uit_stat(++this->stats.delete_recolorings;)
 
-                Node<K, V>* sibling = node->GetSibling();
-                Node<K, V>* parent = node->parent;
+                node_type* sibling = node->GetSibling();
+                node_type* parent = node->parent;
 
                 if (sibling == nullptr)
                 {
@@ -1015,13 +1131,13 @@ namespace UIT
                                 {
                                     sibling->left_child->color = sibling->color;
                                     sibling->color = parent->color;
-                                    parent = this->RotateRight(parent);
+                                    this->RotateRight(parent);
                                 }
                                 else
                                 {
                                     sibling->left_child->color = parent->color;
                                     sibling = this->RotateRight(sibling);
-                                    parent = this->RotateLeft(parent);
+                                    this->RotateLeft(parent);
                                 }
                             }
                             else
@@ -1030,13 +1146,13 @@ namespace UIT
                                 {
                                     sibling->right_child->color = parent->color;
                                     sibling = this->RotateLeft(sibling);
-                                    parent = this->RotateRight(parent);
+                                    this->RotateRight(parent);
                                 }
                                 else
                                 {
                                     sibling->right_child->color = sibling->color;
                                     sibling->color = parent->color;
-                                    parent = this->RotateLeft(parent);
+                                    this->RotateLeft(parent);
                                 }
                             }
                             parent->color = Color::BLACK;
@@ -1058,10 +1174,10 @@ namespace UIT
                 }
             }
 
-            void Delete(Node<K, V>* node)
+            void Delete(node_type* node)
             {
-                Node<K, V>* parent = node->parent;
-                Node<K, V>* replacement;
+                node_type* parent = node->parent;
+                node_type* replacement;
                 if (node->left_child == nullptr && node->right_child == nullptr)
                 {
                     replacement = nullptr;
@@ -1087,6 +1203,11 @@ namespace UIT
 
                 bool double_black = ((replacement == nullptr || replacement->color == Color::BLACK) &&
                                      (node->color == Color::BLACK));
+                if (node->left_child == nullptr || node->right_child == nullptr)
+                {
+                    // This is the node that actually leaves the tree, two children nodes swap contents and recurse
+                    this->Untrack(node);
+                }
 
                 if (replacement == nullptr)
                 {
@@ -1111,12 +1232,12 @@ namespace UIT
                         if (node->IsLeftChild())
                         {
                             node->parent->left_child = nullptr;
-                            node->parent->UpdateMax();
+                            Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(node->parent);
                         }
                         else
                         {
                             node->parent->right_child = nullptr;
-                            node->parent->UpdateMax();
+                            Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(node->parent);
                         }
                     }
                     // Delete node
@@ -1130,6 +1251,7 @@ namespace UIT
                     {
                         this->root = replacement;
                         replacement->parent = nullptr;
+                        replacement->color = Color::BLACK;
                         this->DeallocateNode(node);
                     }
                     else
@@ -1144,6 +1266,7 @@ namespace UIT
                         }
                         this->DeallocateNode(node);
                         replacement->parent = parent;
+                        Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(parent);
                         if (double_black)
                         {
                             // u and v both black, fix double black at u
@@ -1158,6 +1281,9 @@ namespace UIT
                     return;
                 }
 
+                // Both ranges change hands, so neither node may keep entries in the buckets of its old range
+                this->Evict(node, node->range_start, node->range_end);
+                this->Evict(replacement, replacement->range_start, replacement->range_end);
                 V value = std::move(replacement->range_value);
                 replacement->range_value = std::move(node->range_value);
                 node->range_value = std::move(value);
@@ -1171,30 +1297,10 @@ namespace UIT
                 this->Delete(replacement);
             }
 
-            void Delete(const K& range_start, const K& range_end, Node<K, V>* node)
-            {
-                if (uit_unlikely(node == nullptr))
-                {
-                    throw RangeNotFound<K>(range_start, range_end);
-                }
-                if (node->IsSame(range_start, range_end))
-                {
-                    this->Delete(node);
-                }
-                else if (node->left_child && node->left_child->max > range_start)
-                {
-                    this->Delete(range_start, range_end, node->left_child);
-                }
-                else
-                {
-                    this->Delete(range_start, range_end, node->right_child);
-                }
-            }
-
-            Node<K, V>* Remove(Node<K, V>* node)
+            node_type* Remove(node_type* node)
             {
-                Node<K, V>* parent = node->parent;
-                Node<K, V>* replacement;
+                node_type* parent = node->parent;
+                node_type* replacement;
                 if (node->left_child == nullptr && node->right_child == nullptr)
                 {
                     replacement = nullptr;
@@ -1220,6 +1326,11 @@ namespace UIT
 
                 bool double_black = ((replacement == nullptr || replacement->color == Color::BLACK) &&
                                      (node->color == Color::BLACK));
+                if (node->left_child == nullptr || node->right_child == nullptr)
+                {
+                    // This is the node that actually leaves the tree, two children nodes swap contents and recurse
+                    this->Untrack(node);
+                }
 
                 if (replacement == nullptr)
                 {
@@ -1244,12 +1355,12 @@ namespace UIT
                         if (node->IsLeftChild())
                         {
                             node->parent->left_child = nullptr;
-                            node->parent->UpdateMax();
+                            Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(node->parent);
                         }
                         else
                         {
                             node->parent->right_child = nullptr;
-                            node->parent->UpdateMax();
+                            Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(node->parent);
                         }
                     }
                     return node;
@@ -1261,6 +1372,7 @@ namespace UIT
                     {
                         this->root = replacement;
                         replacement->parent = nullptr;
+                        replacement->color = Color::BLACK;
                     }
                     else
                     {
@@ -1273,6 +1385,7 @@ namespace UIT
                             parent->right_child = replacement;
                         }
                         replacement->parent = parent;
+                        Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(parent);
                         if (double_black)
                         {
                             // u and v both black, fix double black at u
@@ -1286,311 +1399,1032 @@ namespace UIT
                     }
                     return node;
                 }
-
-                V value = std::move(replacement->range_value);
-                replacement->range_value = std::move(node->range_value);
-                node->range_value = std::move(value);
-                K key = replacement->range_start;
-                replacement->range_start = node->range_start;
-                node->range_start = key;
-                key = replacement->range_end;
-                replacement->range_end = node->range_end;
-                node->range_end = key;
-                // Delete node
-                return this->Remove(replacement);
+
+                // Both ranges change hands, so neither node may keep entries in the buckets of its old range
+                this->Evict(node, node->range_start, node->range_end);
+                this->Evict(replacement, replacement->range_start, replacement->range_end);
+                V value = std::move(replacement->range_value);
+                replacement->range_value = std::move(node->range_value);
+                node->range_value = std::move(value);
+                K key = replacement->range_start;
+                replacement->range_start = node->range_start;
+                node->range_start = key;
+                key = replacement->range_end;
+                replacement->range_end = node->range_end;
+                node->range_end = key;
+                // Delete node
+                return this->Remove(replacement);
+            }
+
+            std::string ToString(const std::string& prefix, node_type* node, bool left, bool addresses) const
+            {
+                std::string tree = "";
+                if (node)
+                {
+                    tree = prefix;
+                    tree += left? "├──" : "└──";
+                    tree += node->ToString(addresses);
+                    tree += "\n";
+
+                    std::string new_prefix = prefix;
+                    new_prefix += left? "│   " : "    ";
+                    tree += this->ToString(new_prefix, node->left_child, true, addresses);
+                    tree += this->ToString(new_prefix, node->right_child, false, addresses);
+                }
+                return tree;
+            }
+
+            // The message is only built when something is actually wrong
+            void RootCheck(const char* location) const
+            {
+                if (Checking::root && this->root && uit_unlikely(this->root->parent != nullptr))
+                {
+                    throw InternalError(std::string("Root node has a parent after executing ") + location);
+                }
+                if (Checking::verify)
+                {
+                    this->Verify(location);
+                }
+            }
+
+            // Returns the black height of the subtree, after checking its links, colors and every augmented field.
+            // previous is the last node visited in order, ranges must be non-empty and come strictly after it, and
+            // nodes counts the visited nodes.
+            std::size_t Verify(const node_type* node, const node_type*& previous, std::size_t& nodes,
+                               const char* location) const
+            {
+                if (node == nullptr)
+                {
+                    return 1;
+                }
+                for (const node_type* child : {node->left_child, node->right_child})
+                {
+                    if (child && child->parent != node)
+                    {
+                        throw InternalError(std::string("Broken parent link after executing ") + location);
+                    }
+                    if (child && node->color == Color::RED && child->color == Color::RED)
+                    {
+                        throw InternalError(std::string("Red node with a red child after executing ") + location);
+                    }
+                }
+                std::size_t left = this->Verify(node->left_child, previous, nodes, location);
+                if (!(node->range_start < node->range_end))
+                {
+                    throw InternalError(std::string("Empty or inverted range after executing ") + location);
+                }
+                if (previous && node->range_start < previous->range_end)
+                {
+                    throw InternalError(std::string("Unordered or overlapping ranges after executing ") + location);
+                }
+                previous = node;
+                ++nodes;
+                std::size_t right = this->Verify(node->right_child, previous, nodes, location);
+                if (left != right)
+                {
+                    throw InternalError(std::string("Unequal black heights after executing ") + location);
+                }
+                K max = node->range_end;
+                if (node->left_child && max < node->left_child->max)
+                {
+                    max = node->left_child->max;
+                }
+                if (node->right_child && max < node->right_child->max)
+                {
+                    max = node->right_child->max;
+                }
+                if (!(max == node->max))
+                {
+                    throw InternalError(std::string("Stale max after executing ") + location);
+                }
+                Tree<K, V, Allocator, Augment, Checking>::VerifyAggregate(
+                        node, location, is_equality_comparable<aggregate_type>());
+                return left + (node->color == Color::BLACK? 1 : 0);
+            }
+
+            // Recomputes the aggregate from the children, only possible when the policy's values can be compared
+            static void VerifyAggregate(const node_type* node, const char* location, std::true_type)
+            {
+                aggregate_type aggregate = Augment::Combine(
+                        Augment::Combine(node->left_child? node->left_child->aggregate : Augment::Identity(),
+                                         Augment::Lift(node->range_start, node->range_end, node->range_value)),
+                        node->right_child? node->right_child->aggregate : Augment::Identity());
+                if (!(aggregate == node->aggregate))
+                {
+                    throw InternalError(std::string("Stale aggregate after executing ") + location);
+                }
+            }
+
+            static void VerifyAggregate(const node_type*, const char*, std::false_type)
+            {
+            }
+
+            // Copy of a single node for Clone, children are linked by the caller
+            node_type* CopyNode(const node_type* source, node_type* parent)
+            {
+                V value(source->range_value);
+                node_type* node = this->AllocateValueNode(source->range_start, source->range_end, value, source->max,
+                                                           parent, source->color);
+                node->aggregate = source->aggregate;
+                return node;
+            }
+
+        public:
+            // Walks the whole tree and throws an InternalError naming location if any invariant is broken: red-black
+            // colors and black heights, parent links, ordered non-overlapping ranges, the augmented max and
+            // aggregate fields, the node count and the cached ends. O(n), the Debug checking policy runs it
+            // after every modification.
+            void Verify(const char* location = "Verify") const
+            {
+                if (this->root == nullptr)
+                {
+                    if (this->count != 0 || this->leftmost != nullptr || this->rightmost != nullptr)
+                    {
+                        throw InternalError(std::string("Empty tree with stale bookkeeping after executing ") +
+                                            location);
+                    }
+                    return;
+                }
+                if (this->root->parent != nullptr || this->root->color != Color::BLACK)
+                {
+                    throw InternalError(std::string("Root node is not a black orphan after executing ") + location);
+                }
+                const node_type* previous = nullptr;
+                std::size_t nodes = 0;
+                this->Verify(this->root, previous, nodes, location);
+                if (this->count != nodes)
+                {
+                    throw InternalError(std::string("Node count does not match the tree after executing ") + location);
+                }
+                const node_type* first = this->root;
+                while (first->left_child)
+                {
+                    first = first->left_child;
+                }
+                if (this->leftmost != first || this->rightmost != previous)
+                {
+                    throw InternalError(std::string("Stale leftmost or rightmost after executing ") + location);
+                }
+            }
+
+            // Allocation functions
+            node_type* AllocateValueNode(const K& range_start, const K& range_end, V& value, const K& max,
+                                          node_type* parent = nullptr, Color color = Color::RED,
+                                          node_type* left_child = nullptr, node_type* right_child = nullptr)
+            {
+                node_type* node = node_traits::allocate(this->node_allocator, 1);
+                node_traits::construct(this->node_allocator, node, range_start, range_end, value, max, parent, color,
+                                       left_child, right_child);
+                return node;
+            }
+
+            node_type* AllocateEmptyNode(const K& range_start, const K& range_end, const K& max,
+                                          node_type* parent = nullptr, Color color = Color::RED,
+                                          node_type* left_child = nullptr, node_type* right_child = nullptr)
+            {
+                node_type* node = node_traits::allocate(this->node_allocator, 1);
+                node_traits::construct(this->node_allocator, node, range_start, range_end, max, parent, color,
+                                       left_child, right_child);
+                return node;
+            }
+
+            void DeallocateNode(node_type* node)
+            {
+                node_traits::destroy(this->node_allocator, node);
+                node_traits::deallocate(this->node_allocator, node, 1);
+            }
+
+            // Deep copy with the exact same shape and colors, built in a single walk without any rebalancing
+            Tree<K, V, Allocator, Augment, Checking> Clone() const
+            {
+                Tree<K, V, Allocator, Augment, Checking> clone(
+                        node_traits::select_on_container_copy_construction(this->node_allocator));
+                if (this->root == nullptr)
+                {
+                    return clone;
+                }
+                const node_type* source = this->root;
+                node_type* copy = clone.CopyNode(source, nullptr);
+                clone.root = copy;
+                clone.count = this->count;
+                while (source)
+                {
+                    if (source == this->leftmost)
+                    {
+                        clone.leftmost = copy;
+                    }
+                    if (source == this->rightmost)
+                    {
+                        clone.rightmost = copy;
+                    }
+                    if (source->left_child && copy->left_child == nullptr)
+                    {
+                        copy->left_child = clone.CopyNode(source->left_child, copy);
+                        source = source->left_child;
+                        copy = copy->left_child;
+                    }
+                    else if (source->right_child && copy->right_child == nullptr)
+                    {
+                        copy->right_child = clone.CopyNode(source->right_child, copy);
+                        source = source->right_child;
+                        copy = copy->right_child;
+                    }
+                    else
+                    {
+                        source = source->parent;
+                        copy = copy->parent;
+                    }
+                }
+                return clone;
+            }
+
+            // Enables the lookup cache with the given number of entries (rounded up to a power of two), or disables it
+            // with 0. Integral points are bucketed by point >> shift, use the typical region size. Note that with the
+            // cache enabled, const lookups update it and are no longer safe to run concurrently.
+            void EnableCache(std::size_t entries, unsigned shift = 12)
+            {
+                std::size_t size = entries? 1 : 0;
+                while (size < entries)
+                {
+                    size <<= 1;
+                }
+                this->cache.assign(size, nullptr);
+                this->cache_shift = shift;
+                this->ResetCacheStats();
+            }
+
+            std::size_t CacheHits() const
+            {
+                return this->cache_hits;
+            }
+
+            std::size_t CacheMisses() const
+            {
+                return this->cache_misses;
+            }
+
+            void ResetCacheStats()
+            {
+                this->cache_hits = 0;
+                this->cache_misses = 0;
+            }
+
+#ifdef UIT_ENABLE_STATS
+            // Snapshot of the operation counters and latency histograms since construction or the last ResetStats()
+            Stats GetStats() const
+            {
+                return this->stats;
+            }
+
+            void ResetStats()
+            {
+                this->stats = Stats();
+            }
+#endif
+
+            void Clear()
+            {
+                this->Clear(std::integral_constant<bool, is_bulk_releasable<node_allocator_type>::value>());
+            }
+
+            V& Access(const K& point)
+            {
+                node_type* node = this->FindCached(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    uit_stat(++this->stats.throws;)
+                    throw PointNotFound<K>(point);
+                }
+                return node->range_value;
             }
 
-            Node<K, V>* Remove(const K& range_start, const K& range_end, Node<K, V>* node)
+            V& Access(const K& range_start, const K& range_end)
             {
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                node_type* node = this->Find(range_start, range_end);
                 if (uit_unlikely(node == nullptr))
                 {
+                    uit_stat(++this->stats.throws;)
                     throw RangeNotFound<K>(range_start, range_end);
                 }
-                if (node->IsSame(range_start, range_end))
+                return node->range_value;
+            }
+
+            V& Access(const K& point, K& found_range_start, K& found_range_end)
+            {
+                node_type* node = this->FindCached(point);
+                if (uit_unlikely(node == nullptr))
                 {
-                    return this->Remove(node);
+                    uit_stat(++this->stats.throws;)
+                    throw PointNotFound<K>(point);
                 }
-                else if (node->left_child && node->left_child->max > range_start)
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                return node->range_value;
+            }
+
+            V& Access(const K& range_start, const K& range_end, K& found_range_start, K& found_range_end)
+            {
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                node_type* node = this->Find(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
                 {
-                    return this->Remove(range_start, range_end, node->left_child);
+                    uit_stat(++this->stats.throws;)
+                    throw RangeNotFound<K>(range_start, range_end);
                 }
-                else
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                return node->range_value;
+            }
+
+            const V& Access(const K& point) const
+            {
+                const node_type* node = this->FindCached(point);
+                if (uit_unlikely(node == nullptr))
                 {
-                    return this->Remove(range_start, range_end, node->right_child);
+                    uit_stat(++this->stats.throws;)
+                    throw PointNotFound<K>(point);
                 }
+                return node->range_value;
             }
 
-            void ShrinkEnd(const K& range_start, const K& range_end, const K& new_range_end, Node<K, V>* node)
+            const V& Access(const K& range_start, const K& range_end) const
             {
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                const node_type* node = this->Find(range_start, range_end);
                 if (uit_unlikely(node == nullptr))
                 {
+                    uit_stat(++this->stats.throws;)
                     throw RangeNotFound<K>(range_start, range_end);
                 }
-                if (node->IsSame(range_start, range_end))
+                return node->range_value;
+            }
+
+            const V& Access(const K& point, K& found_range_start, K& found_range_end) const
+            {
+                const node_type* node = this->FindCached(point);
+                if (uit_unlikely(node == nullptr))
                 {
-                    node->range_end = new_range_end;
+                    uit_stat(++this->stats.throws;)
+                    throw PointNotFound<K>(point);
                 }
-                else if (node->left_child && node->left_child->max > range_start)
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                return node->range_value;
+            }
+
+            const V& Access(const K& range_start, const K& range_end, K& found_range_start, K& found_range_end) const
+            {
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                const node_type* node = this->Find(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
                 {
-                    this->ShrinkEnd(range_start, range_end, new_range_end, node->left_child);
+                    uit_stat(++this->stats.throws;)
+                    throw RangeNotFound<K>(range_start, range_end);
                 }
-                else
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                return node->range_value;
+            }
+
+            bool Access(const K& point, V*& ret)
+            {
+                node_type* node = this->FindCached(point);
+                if (uit_unlikely(node == nullptr))
                 {
-                    this->ShrinkEnd(range_start, range_end, new_range_end, node->right_child);
+                    return false;
                 }
-                node->UpdateMax();
+                ret = &node->range_value;
+                return true;
             }
 
-            std::string ToString(const std::string& prefix, Node<K, V>* node, bool left, bool addresses) const
+            bool Access(const K& range_start, const K& range_end, V*& ret)
             {
-                std::string tree = "";
-                if (node)
+                node_type* node = this->Find(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
                 {
-                    tree = prefix;
-                    tree += left? "├──" : "└──";
-                    tree += node->ToString(addresses);
-                    tree += "\n";
+                    return false;
+                }
+                ret = &node->range_value;
+                return true;
+            }
 
-                    std::string new_prefix = prefix;
-                    new_prefix += left? "│   " : "    ";
-                    tree += this->ToString(new_prefix, node->left_child, true, addresses);
-                    tree += this->ToString(new_prefix, node->right_child, false, addresses);
+            bool Access(const K& point, K& found_range_start, K& found_range_end, V*& ret)
+            {
+                node_type* node = this->FindCached(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    return false;
                 }
-                return tree;
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                ret = &node->range_value;
+                return true;
             }
 
-            void RootCheck(std::string location) const
+            bool Access(const K& range_start, const K& range_end, K& found_range_start, K& found_range_end, V*& ret)
             {
-                if (this->root)
+                node_type* node = this->Find(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
                 {
-                    if (this->root->parent)
-                    {
-                        throw InternalError("Root node has a parent after executing " + location);
-                    }
+                    return false;
                 }
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                ret = &node->range_value;
+                return true;
             }
 
-        public:
-            // Allocation function
-            Node<K, V>* AllocateValueNode(const K& range_start, const K& range_end, V& value, const K& max,
-                                          Node<K, V>* parent = nullptr, Color color = Color::RED,
-                                          Node<K, V>* left_child = nullptr, Node<K, V>* right_child = nullptr)
-            {
-                Node<K, V>* node = std::allocator_traits<Allocator>::allocate(this->node_allocator, 1);
-                std::allocator_traits<Allocator>::construct(this->node_allocator, node, range_start, range_end,
-                                                            value, max, parent, color, left_child, right_child);
-                return node;
+            bool Access(const K& point, V const*& ret) const
+            {
+                const node_type* node = this->FindCached(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    return false;
+                }
+                ret = &node->range_value;
+                return true;
             }
 
-            Node<K, V>* AllocateEmptyNode(const K& range_start, const K& range_end, const K& max,
-                                          Node<K, V>* parent = nullptr, Color color = Color::RED,
-                                          Node<K, V>* left_child = nullptr, Node<K, V>* right_child = nullptr)
+            bool Access(const K& range_start, const K& range_end, V const*& ret) const
             {
-                Node<K, V>* node = std::allocator_traits<Allocator>::allocate(this->node_allocator, 1);
-                std::allocator_traits<Allocator>::construct(this->node_allocator, node, range_start, range_end, max,
-                                                            parent, color, left_child, right_child);
-                return node;
+                const node_type* node = this->Find(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
+                {
+                    return false;
+                }
+                ret = &node->range_value;
+                return true;
             }
 
-            void DeallocateNode(Node<K, V>* node)
+            bool Access(const K& point, K& found_range_start, K& found_range_end, V const*& ret) const
             {
-                std::allocator_traits<Allocator>::destroy(this->node_allocator, node);
-                std::allocator_traits<Allocator>::deallocate(this->node_allocator, node, 1);
+                const node_type* node = this->FindCached(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    return false;
+                }
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                ret = &node->range_value;
+                return true;
             }
 
-            V& Access(const K& point)
+            bool Access(const K& range_start, const K& range_end, K& found_range_start, K& found_range_end,
+                        V const*& ret) const
             {
-                V& tmp = this->Access(point, this->root);
-                return tmp;
+                const node_type* node = this->Find(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
+                {
+                    return false;
+                }
+                found_range_start = node->range_start;
+                found_range_end = node->range_end;
+                ret = &node->range_value;
+                return true;
             }
 
-            V& Access(const K& range_start, const K& range_end)
+            bool Has(const K& point) const
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                V& tmp = this->Access(range_start, range_end, this->root);
-                return tmp;
+                return this->FindCached(point) != nullptr;
             }
 
-            V& Access(const K& point, K& found_range_start, K& found_range_end)
+            bool Has(const K& range_start, const K& range_end) const
             {
-                V& tmp = this->Access(point, this->root, found_range_start, found_range_end);
-                return tmp;
+                return this->Find(range_start, range_end) != nullptr;
             }
 
-            V& Access(const K& range_start, const K& range_end, K& found_range_start, K& found_range_end)
+            // Visits every stored range overlapping [range_start, range_end) in order, as
+            // visitor(range_start, range_end, value). Takes O(log n + k) for k overlaps and never allocates.
+            template <class Visitor>
+            std::size_t ForEachOverlapping(const K& range_start, const K& range_end, Visitor visitor)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                V& tmp = this->Access(range_start, range_end, this->root, found_range_start, found_range_end);
-                return tmp;
+                std::size_t visited = 0;
+                for (node_type* node = this->FindFirstOverlapping(range_start, range_end);
+                     node && node->range_start < range_end; node = node->Next())
+                {
+                    visitor(static_cast<const K&>(node->range_start), static_cast<const K&>(node->range_end),
+                            node->range_value);
+                    ++visited;
+                }
+                return visited;
             }
 
-            const V& Access(const K& point) const
+            template <class Visitor>
+            std::size_t ForEachOverlapping(const K& range_start, const K& range_end, Visitor visitor) const
             {
-                V& tmp = this->Access(point, this->root);
-                return tmp;
+                std::size_t visited = 0;
+                for (const node_type* node = this->FindFirstOverlapping(range_start, range_end);
+                     node && node->range_start < range_end; node = node->Next())
+                {
+                    visitor(static_cast<const K&>(node->range_start), static_cast<const K&>(node->range_end),
+                            static_cast<const V&>(node->range_value));
+                    ++visited;
+                }
+                return visited;
             }
 
-            const V& Access(const K& range_start, const K& range_end) const
+            // Lazy iterator pair over the stored ranges overlapping [range_start, range_end), both ends are found
+            // with one descent each. The pair is invalidated by modifications like any other iterator.
+            std::pair<iterator, iterator> Overlapping(const K& range_start, const K& range_end)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                V& tmp = this->Access(range_start, range_end, this->root);
-                return tmp;
+                node_type* first = this->FindFirstOverlapping(range_start, range_end);
+                node_type* last = first? this->FindFirstStartingFrom(range_end) : nullptr;
+                return std::make_pair(iterator(first, this->rightmost), iterator(last, this->rightmost));
             }
 
-            const V& Access(const K& point, K& found_range_start, K& found_range_end) const
+            std::pair<const_iterator, const_iterator> Overlapping(const K& range_start, const K& range_end) const
             {
-                V& tmp = this->Access(point, this->root, found_range_start, found_range_end);
-                return tmp;
+                const node_type* first = this->FindFirstOverlapping(range_start, range_end);
+                const node_type* last = first? this->FindFirstStartingFrom(range_end) : nullptr;
+                return std::make_pair(const_iterator(first, this->rightmost), const_iterator(last, this->rightmost));
             }
 
-            const V& Access(const K& range_start, const K& range_end, K& found_range_start, K& found_range_end) const
+            // Lowest start at or after hint of a free gap of at least min_size, O(log n) through the Gaps
+            // augmentation, which the tree has to be declared with (alone or in a Join). The space after the last
+            // range counts as free, so this always returns an address; it is up to the caller to check that the gap
+            // fits below the end of its address space.
+            K FindGap(const K& min_size, const K& hint) const
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                V& tmp = this->Access(range_start, range_end, this->root, found_range_start, found_range_end);
-                return tmp;
+                static_assert(std::is_arithmetic<K>::value, "FindGap needs an arithmetic key type");
+                static_assert(AugmentPart<Augment, Gaps<K>>::value, "FindGap needs the UIT::Gaps augmentation");
+                using gaps = AugmentPart<Augment, Gaps<K>>;
+                const node_type* containing = this->Find(hint);
+                K start = containing? containing->range_end : hint;
+                const node_type* node = this->FindFirstStartingFrom(start);
+                if (node == nullptr || !(node->range_start - start < min_size))
+                {
+                    return start;
+                }
+                // Gaps after node are either in its right subtree, or right before an ancestor we come up to from
+                // the left, or in the right subtree of that ancestor
+                if (node->right_child)
+                {
+                    if (!(gaps::Get(node->right_child->aggregate).min - node->range_end < min_size))
+                    {
+                        return node->range_end;
+                    }
+                    if (!(gaps::Get(node->right_child->aggregate).max_gap < min_size))
+                    {
+                        return FirstGap(node->right_child, min_size);
+                    }
+                }
+                for (; node->parent; node = node->parent)
+                {
+                    const node_type* parent = node->parent;
+                    if (node != parent->left_child)
+                    {
+                        continue;
+                    }
+                    if (!(parent->range_start - node->max < min_size))
+                    {
+                        return node->max;
+                    }
+                    if (parent->right_child)
+                    {
+                        if (!(gaps::Get(parent->right_child->aggregate).min - parent->range_end < min_size))
+                        {
+                            return parent->range_end;
+                        }
+                        if (!(gaps::Get(parent->right_child->aggregate).max_gap < min_size))
+                        {
+                            return FirstGap(parent->right_child, min_size);
+                        }
+                    }
+                }
+                return this->rightmost->range_end;
             }
 
-            bool Access(const K& point, V*& ret)
+            // Order statistics through the subtree counts of the Counts augmentation, which the tree has to be declared
+            // with (alone or in a Join), all O(log n). Select returns the index-th range in order, or end() when index
+            // is past the last one.
+            iterator Select(std::size_t index)
             {
-                bool tmp = this->Access(point, this->root, ret);
-                return tmp;
+                static_assert(AugmentPart<Augment, Counts>::value, "Select needs the UIT::Counts augmentation");
+                return iterator(this->SelectNode(index), this->rightmost);
             }
 
-            bool Access(const K& range_start, const K& range_end, V*& ret)
+            const_iterator Select(std::size_t index) const
             {
-                bool tmp = this->Access(range_start, range_end, this->root, ret);
-                return tmp;
+                static_assert(AugmentPart<Augment, Counts>::value, "Select needs the UIT::Counts augmentation");
+                return const_iterator(this->SelectNode(index), this->rightmost);
             }
 
-            bool Access(const K& point, K& found_range_start, K& found_range_end, V*& ret)
+            // Number of stored ranges starting before point
+            std::size_t Rank(const K& point) const
             {
-                bool tmp = this->Access(point, this->root, found_range_start, found_range_end, ret);
-                return tmp;
+                static_assert(AugmentPart<Augment, Counts>::value, "Rank needs the UIT::Counts augmentation");
+                return this->CountStartsBefore(point);
             }
 
-            bool Access(const K& range_start, const K& range_end, K& found_range_start, K& found_range_end, V*& ret)
+            // Number of stored ranges overlapping [range_start, range_end), the ones starting before range_end minus
+            // the ones already over by range_start
+            std::size_t CountOverlapping(const K& range_start, const K& range_end) const
             {
-                bool tmp = this->Access(range_start, range_end, this->root, found_range_start, found_range_end, ret);
-                return tmp;
+                static_assert(AugmentPart<Augment, Counts>::value,
+                              "CountOverlapping needs the UIT::Counts augmentation");
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                return this->CountStartsBefore(range_end) - this->CountEndsUpTo(range_start);
             }
 
-            bool Access(const K& point, V const*& ret)
+            // Combines the augmentation of every stored range overlapping [range_start, range_end), in order, in
+            // O(log n). Ranges are taken whole, even when they stick out of the window.
+            aggregate_type Reduce(const K& range_start, const K& range_end) const
             {
-                bool tmp = this->Access(point, this->root, ret);
-                return tmp;
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                // Go down to the first node inside the window, the ones below it split into a suffix of its left
+                // subtree and a prefix of its right subtree
+                const node_type* node = this->root;
+                while (node && !node->IsOverlapping(range_start, range_end))
+                {
+                    node = node->range_end <= range_start? node->right_child : node->left_child;
+                }
+                if (node == nullptr)
+                {
+                    return Augment::Identity();
+                }
+                aggregate_type left = Augment::Identity();
+                for (const node_type* x = node->left_child; x;)
+                {
+                    if (range_start < x->range_end)
+                    {
+                        // x and its whole right subtree are inside, and come after everything gathered so far
+                        aggregate_type here = Augment::Lift(x->range_start, x->range_end, x->range_value);
+                        aggregate_type after = Tree<K, V, Allocator, Augment, Checking>::Aggregate(x->right_child);
+                        here = Augment::Combine(here, after);
+                        left = Augment::Combine(here, left);
+                        x = x->left_child;
+                    }
+                    else
+                    {
+                        x = x->right_child;
+                    }
+                }
+                aggregate_type right = Augment::Identity();
+                for (const node_type* x = node->right_child; x;)
+                {
+                    if (x->range_start < range_end)
+                    {
+                        // x and its whole left subtree are inside, and come before everything gathered so far
+                        aggregate_type here = Tree<K, V, Allocator, Augment, Checking>::Aggregate(x->left_child);
+                        here = Augment::Combine(here, Augment::Lift(x->range_start, x->range_end, x->range_value));
+                        right = Augment::Combine(right, here);
+                        x = x->right_child;
+                    }
+                    else
+                    {
+                        x = x->left_child;
+                    }
+                }
+                aggregate_type middle = Augment::Lift(node->range_start, node->range_end, node->range_value);
+                return Augment::Combine(Augment::Combine(left, middle), right);
             }
 
-            bool Access(const K& range_start, const K& range_end, V const*& ret)
+            // Values handed out by Access can be changed in place behind the augmentation's back, Refresh recomputes
+            // it for the range holding point
+            void Refresh(const K& point)
             {
-                bool tmp = this->Access(range_start, range_end, this->root, ret);
-                return tmp;
+                node_type* node = this->Find(point);
+                if (uit_unlikely(node == nullptr))
+                {
+                    uit_stat(++this->stats.throws;)
+                    throw PointNotFound<K>(point);
+                }
+                Tree<K, V, Allocator, Augment, Checking>::UpdateAllMax(node);
             }
 
-            bool Access(const K& point, K& found_range_start, K& found_range_end, V const*& ret)
+            // Batched lookups of count points. A missing point gets a nullptr (or false) result and leaves its found
+            // range untouched. The Access variants return how many points were found.
+            void HasBatch(const K* points, std::size_t count, bool* results) const
             {
-                bool tmp = this->Access(point, this->root, found_range_start, found_range_end, ret);
-                return tmp;
+                this->FindBatch(points, count, [results](std::size_t index, const node_type* node)
+                {
+                    results[index] = node != nullptr;
+                });
             }
 
-            bool Access(const K& range_start, const K& range_end, K& found_range_start, K& found_range_end, V const*& ret)
+            std::size_t AccessBatch(const K* points, std::size_t count, V** results)
             {
-                bool tmp = this->Access(range_start, range_end, this->root, found_range_start, found_range_end, ret);
-                return tmp;
+                std::size_t found = 0;
+                this->FindBatch(points, count, [results, &found](std::size_t index, node_type* node)
+                {
+                    results[index] = node? &node->range_value : nullptr;
+                    found += node != nullptr;
+                });
+                return found;
             }
 
-            bool Has(const K& point) const
+            std::size_t AccessBatch(const K* points, std::size_t count, V** results, K* found_range_starts,
+                                    K* found_range_ends)
             {
-                bool tmp = this->Has(point, this->root);
-                return tmp;
+                std::size_t found = 0;
+                this->FindBatch(points, count, [=, &found](std::size_t index, node_type* node)
+                {
+                    results[index] = nullptr;
+                    if (node)
+                    {
+                        results[index] = &node->range_value;
+                        found_range_starts[index] = node->range_start;
+                        found_range_ends[index] = node->range_end;
+                        ++found;
+                    }
+                });
+                return found;
             }
 
-            bool Has(const K& range_start, const K& range_end) const
+            std::size_t AccessBatch(const K* points, std::size_t count, V const** results) const
             {
-                bool tmp = this->Has(range_start, range_end, this->root);
-                return tmp;
+                std::size_t found = 0;
+                this->FindBatch(points, count, [results, &found](std::size_t index, const node_type* node)
+                {
+                    results[index] = node? &node->range_value : nullptr;
+                    found += node != nullptr;
+                });
+                return found;
+            }
+
+            std::size_t AccessBatch(const K* points, std::size_t count, V const** results, K* found_range_starts,
+                                    K* found_range_ends) const
+            {
+                std::size_t found = 0;
+                this->FindBatch(points, count, [=, &found](std::size_t index, const node_type* node)
+                {
+                    results[index] = nullptr;
+                    if (node)
+                    {
+                        results[index] = &node->range_value;
+                        found_range_starts[index] = node->range_start;
+                        found_range_ends[index] = node->range_end;
+                        ++found;
+                    }
+                });
+                return found;
             }
 
             void Insert(const K& range_start, const K& range_end, V& value)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                this->Insert(range_start, range_end, value, this->root);
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::INSERT));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                node_type* parent = this->FindInsertParent(range_start, range_end);
+                this->Link(this->AllocateValueNode(range_start, range_end, value, range_end), parent);
                 this->RootCheck("Insert Range");
             }
 
+            // Inserts right before hint, skipping the descent when the range belongs there, e.g. end() for appends.
+            // Returns an iterator to the new range.
+            iterator Insert(const_iterator hint, const K& range_start, const K& range_end, V& value)
+            {
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::INSERT));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                node_type* parent = this->FindHintParent(hint, range_start, range_end);
+                node_type* node = this->AllocateValueNode(range_start, range_end, value, range_end);
+                this->Link(node, parent);
+                this->RootCheck("Insert Range With Hint");
+                return iterator(node, this->rightmost);
+            }
+
+            iterator Insert(const_iterator hint, const K& range_start, const K& range_end)
+            {
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::INSERT));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                node_type* parent = this->FindHintParent(hint, range_start, range_end);
+                node_type* node = this->AllocateEmptyNode(range_start, range_end, range_end);
+                this->Link(node, parent);
+                this->RootCheck("Insert Range With Hint");
+                return iterator(node, this->rightmost);
+            }
+
             void Insert(const K& range_start, const K& range_end)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                this->Insert(range_start, range_end, this->root);
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::INSERT));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                node_type* parent = this->FindInsertParent(range_start, range_end);
+                this->Link(this->AllocateEmptyNode(range_start, range_end, range_end), parent);
                 this->RootCheck("Insert Range");
             }
 
-            void Insert(Node<K, V>* insert_node)
+            void Insert(node_type* insert_node)
             {
-                Tree<K, V, Allocator>::OrderCheck(insert_node->range_start, insert_node->range_end);
-                this->Insert(insert_node, this->root);
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::INSERT));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(insert_node->range_start, insert_node->range_end);
+                this->Link(insert_node, this->FindInsertParent(insert_node->range_start, insert_node->range_end));
                 this->RootCheck("Insert Node");
             }
 
             void GrowEnd(const K& range_start, const K& range_end, const K& new_range_end)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                Tree<K, V, Allocator>::OrderCheck(range_end, new_range_end);
-                if (uit_unlikely(this->Overlapping(range_end, new_range_end, this->root)))
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::RESIZE));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_end, new_range_end);
+                node_type* next = this->MoveEnd(this->FindExact(range_start, range_end), new_range_end);
+                if (uit_unlikely(next != nullptr))
                 {
-                    throw RangeExists<K>(range_start, range_end);
+                    uit_stat(++this->stats.throws;)
+                    throw RangeExists<K>(range_end, new_range_end, next->range_start, next->range_end);
                 }
-                this->GrowEnd(range_start, range_end, new_range_end, this->root);
                 this->RootCheck("Grow End");
             }
 
             void GrowStart(const K& range_start, const K& range_end, const K& new_range_start)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                Tree<K, V, Allocator>::OrderCheck(new_range_start, range_end);
-                Node<K, V>* to_modify_node = this->Remove(range_start, range_end, this->root);
-                to_modify_node->range_start = new_range_start;
-                this->Insert(to_modify_node, this->root);
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::RESIZE));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(new_range_start, range_end);
+                node_type* previous = this->MoveStart(this->FindExact(range_start, range_end), new_range_start);
+                if (uit_unlikely(previous != nullptr))
+                {
+                    uit_stat(++this->stats.throws;)
+                    throw RangeExists<K>(new_range_start, range_end, previous->range_start, previous->range_end);
+                }
                 this->RootCheck("Grow Start");
             }
 
             void Delete(const K& range_start, const K& range_end)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                this->Delete(range_start, range_end, this->root);
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::DELETE));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                this->Delete(this->FindExact(range_start, range_end));
                 this->RootCheck("Delete");
             }
 
-            Node<K, V>* Remove(const K& range_start, const K& range_end)
+            node_type* Remove(const K& range_start, const K& range_end)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                Node<K, V>* tmp = this->Remove(range_start, range_end, this->root);
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                node_type* tmp = this->Remove(this->FindExact(range_start, range_end));
                 this->RootCheck("Remove");
                 return tmp;
             }
 
             void ShrinkEnd(const K& range_start, const K& range_end, const K& new_range_end)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                Tree<K, V, Allocator>::OrderCheck(new_range_end, range_end);
-                this->ShrinkEnd(range_start, range_end, new_range_end, this->root);
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::RESIZE));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, new_range_end);
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(new_range_end, range_end);
+                this->MoveEnd(this->FindExact(range_start, range_end), new_range_end);
                 this->RootCheck("Shrink End");
             }
 
             void ShrinkStart(const K& range_start, const K& range_end, const K& new_range_start)
             {
-                Tree<K, V, Allocator>::OrderCheck(range_start, range_end);
-                Tree<K, V, Allocator>::OrderCheck(new_range_start, range_end);
-                Node<K, V>* to_modify_node = this->Remove(range_start, range_end, this->root);
-                to_modify_node->range_start = new_range_start;
-                this->Insert(to_modify_node, this->root);
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::RESIZE));)
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(new_range_start, range_end);
+                node_type* previous = this->MoveStart(this->FindExact(range_start, range_end), new_range_start);
+                if (uit_unlikely(previous != nullptr))
+                {
+                    uit_stat(++this->stats.throws;)
+                    throw RangeExists<K>(new_range_start, range_end, previous->range_start, previous->range_end);
+                }
                 this->RootCheck("Shrink Start");
             }
 
+            // Non-throwing counterparts of the modifiers above. Failures are reported as a Status and leave the tree
+            // untouched, which is much cheaper than an exception when misses and conflicts are routine.
+            Status TryInsert(const K& range_start, const K& range_end, V& value)
+            {
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::INSERT));)
+                if (uit_unlikely((!Tree<K, V, Allocator, Augment, Checking>::IsValid(range_start, range_end))))
+                {
+                    return Status::INVALID_RANGE;
+                }
+                node_type* existing;
+                node_type* parent = this->FindInsertParent(range_start, range_end, existing);
+                if (uit_unlikely(existing != nullptr))
+                {
+                    return Status::RANGE_EXISTS;
+                }
+                this->Link(this->AllocateValueNode(range_start, range_end, value, range_end), parent);
+                this->RootCheck("Try Insert Range");
+                return Status::SUCCESS;
+            }
+
+            Status TryInsert(const K& range_start, const K& range_end)
+            {
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::INSERT));)
+                if (uit_unlikely((!Tree<K, V, Allocator, Augment, Checking>::IsValid(range_start, range_end))))
+                {
+                    return Status::INVALID_RANGE;
+                }
+                node_type* existing;
+                node_type* parent = this->FindInsertParent(range_start, range_end, existing);
+                if (uit_unlikely(existing != nullptr))
+                {
+                    return Status::RANGE_EXISTS;
+                }
+                this->Link(this->AllocateEmptyNode(range_start, range_end, range_end), parent);
+                this->RootCheck("Try Insert Range");
+                return Status::SUCCESS;
+            }
+
+            Status TryDelete(const K& range_start, const K& range_end)
+            {
+                uit_stat(LatencyTimer timer(this->stats.Latency(Operation::DELETE));)
+                if (uit_unlikely((!Tree<K, V, Allocator, Augment, Checking>::IsValid(range_start, range_end))))
+                {
+                    return Status::INVALID_RANGE;
+                }
+                node_type* node = this->FindStored(range_start, range_end);
+                if (uit_unlikely(node == nullptr))
+                {
+                    return Status::RANGE_NOT_FOUND;
+                }
+                this->Delete(node);
+                this->RootCheck("Try Delete");
+                return Status::SUCCESS;
+            }
+
+            Status TryGrowEnd(const K& range_start, const K& range_end, const K& new_range_end)
+            {
+                return this->TryResizeEnd(range_start, range_end, new_range_end, range_end < new_range_end);
+            }
+
+            Status TryShrinkEnd(const K& range_start, const K& range_end, const K& new_range_end)
+            {
+                return this->TryResizeEnd(range_start, range_end, new_range_end, new_range_end < range_end);
+            }
+
+            Status TryGrowStart(const K& range_start, const K& range_end, const K& new_range_start)
+            {
+                return this->TryResizeStart(range_start, range_end, new_range_start, new_range_start < range_start);
+            }
+
+            Status TryShrinkStart(const K& range_start, const K& range_end, const K& new_range_start)
+            {
+                return this->TryResizeStart(range_start, range_end, new_range_start, range_start < new_range_start);
+            }
+
+            // Splits [range_start, range_end) into [range_start, at) and [at, range_end), the upper part gets a copy of
+            // the value. Only the new node is inserted, right next to the found one.
+            void Split(const K& range_start, const K& range_end, const K& at)
+            {
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, at);
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(at, range_end);
+                node_type* node = this->FindExact(range_start, range_end);
+                // The upper part is built before anything changes, so a throwing allocator or value copy leaves the
+                // tree as it was
+                V value(node->range_value);
+                node_type* upper = this->AllocateValueNode(at, range_end, value, range_end);
+                this->Evict(node, at, range_end);
+                node->range_end = at;
+                // Link updates the augmentation from the new node's parent up, and node is on that path
+                this->LinkAfter(upper, node);
+                this->RootCheck("Split");
+            }
+
+            // Extends [range_start, range_end) over the next range if that starts exactly at range_end, keeping this
+            // range's value and deleting the next node. Returns false if there is no such neighbour.
+            bool MergeWithNext(const K& range_start, const K& range_end)
+            {
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                node_type* node = this->FindExact(range_start, range_end);
+                bool merged = this->MergeWithNext(node);
+                this->RootCheck("Merge With Next");
+                return merged;
+            }
+
+            // Merges every pair of touching neighbours overlapping [range_start, range_end) for which
+            // pred(value, next_value) holds, in one in-order sweep. Returns the number of merges.
+            template <class Predicate = std::equal_to<V>>
+            std::size_t Coalesce(const K& range_start, const K& range_end, Predicate pred = Predicate())
+            {
+                Tree<K, V, Allocator, Augment, Checking>::OrderCheck(range_start, range_end);
+                std::size_t merges = 0;
+                node_type* node = this->FindFirstOverlapping(range_start, range_end);
+                while (node)
+                {
+                    node_type* next = node->Next();
+                    if (next == nullptr || !(next->range_start < range_end))
+                    {
+                        break;
+                    }
+                    if (next->range_start == node->range_end && pred(static_cast<const V&>(node->range_value),
+                                                                     static_cast<const V&>(next->range_value)))
+                    {
+                        // Deleting next never moves node's contents, as it only ever swaps with its own successor
+                        this->MergeWithNext(node);
+                        ++merges;
+                    }
+                    else
+                    {
+                        node = next;
+                    }
+                }
+                this->RootCheck("Coalesce");
+                return merges;
+            }
+
             std::string ToString(bool addresses = false) const
             {
                 return this->ToString("", this->root, false, addresses);
             }
     };
+
+    template <typename K, typename V, class Allocator, class Augment, class Checking>
+    void swap(Tree<K, V, Allocator, Augment, Checking>& a, Tree<K, V, Allocator, Augment, Checking>& b) noexcept
+    {
+        a.swap(b);
+    }
 }
 
 #endif // _UNIQUEINTERVALTREE_TREE_HPP_
@@ -6,5 +6,6 @@
 
 #define uit_likely(x)       __builtin_expect((x), 1)
 #define uit_unlikely(x)     __builtin_expect((x), 0)
+#define uit_prefetch(x)     __builtin_prefetch((x))
 
 #endif // _UNIQUEINTERVALTREE_UTILS_HPP_
@@ -0,0 +1,415 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef _UNIQUEINTERVALTREE_TEST_DIFFERENTIAL_HPP_
+#define _UNIQUEINTERVALTREE_TEST_DIFFERENTIAL_HPP_
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+// Differential driver shared by the randomized test and the libFuzzer target. Every step applies one operation to a
+// Tree and to a plain std::map of start -> (end, value), then compares what both report. Any mismatch, and any broken
+// invariant found by Tree::Verify(), is thrown as a std::logic_error naming the step.
+template <class Tree>
+class Differential
+{
+    public:
+        using Reference = std::map<uint64_t, std::pair<uint64_t, uint64_t>>;
+
+        // Keys live in a window narrow enough for inserts to collide and ranges to touch often
+        static constexpr uint64_t base = 64;
+        static constexpr uint64_t window = 16384;
+        static constexpr int operations = 16;
+
+        Tree tree;
+        Reference reference;
+        uint64_t steps = 0;
+
+        // Applies operation op % operations with three raw arguments, then compares the query results on them
+        void Step(uint8_t op, uint16_t a, uint16_t b, uint16_t c)
+        {
+            ++this->steps;
+            int operation = op % Differential<Tree>::operations;
+            // Deletes mostly miss so the tree fills up to several hundred ranges instead of hovering near empty
+            bool existing = (operation == 2 || operation == 3)? (c & 7) == 0 : (c & 1) == 0;
+            uint64_t start, end;
+            this->Pick(a, b, existing, start, end);
+            // A bound that lands on either side of the old one, and sometimes on the other end of the range
+            uint64_t bound = (c & 2)? (c >> 2) % 16 + end - 8 : (c >> 2) % 16 + start - 8;
+            uint64_t value = c % 4;
+            switch (operation)
+            {
+                case 0:
+                    this->Expect(this->Catch([&] { this->tree.Insert(start, end, value); }),
+                                 this->Insert(start, end, value), "Insert");
+                    break;
+                case 1:
+                    this->Expect(this->tree.TryInsert(start, end, value), this->Insert(start, end, value), "TryInsert");
+                    break;
+                case 2:
+                    this->Expect(this->Catch([&] { this->tree.Delete(start, end); }), this->Delete(start, end),
+                                 "Delete");
+                    break;
+                case 3:
+                    this->Expect(this->tree.TryDelete(start, end), this->Delete(start, end), "TryDelete");
+                    break;
+                case 4:
+                    this->Expect(this->Catch([&] { this->tree.GrowEnd(start, end, bound); }),
+                                 this->ResizeEnd(start, end, bound, end < bound), "GrowEnd");
+                    break;
+                case 5:
+                    this->Expect(this->Catch([&] { this->tree.ShrinkEnd(start, end, bound); }),
+                                 this->ResizeEnd(start, end, bound, bound < end), "ShrinkEnd");
+                    break;
+                case 6:
+                    this->Expect(this->Catch([&] { this->tree.GrowStart(start, end, bound); }),
+                                 this->ResizeStart(start, end, bound, true), "GrowStart");
+                    break;
+                case 7:
+                    this->Expect(this->Catch([&] { this->tree.ShrinkStart(start, end, bound); }),
+                                 this->ResizeStart(start, end, bound, true), "ShrinkStart");
+                    break;
+                case 8:
+                    this->Expect(this->tree.TryGrowEnd(start, end, bound),
+                                 this->ResizeEnd(start, end, bound, end < bound), "TryGrowEnd");
+                    break;
+                case 9:
+                    this->Expect(this->tree.TryShrinkEnd(start, end, bound),
+                                 this->ResizeEnd(start, end, bound, bound < end), "TryShrinkEnd");
+                    break;
+                case 10:
+                    this->Expect(this->tree.TryGrowStart(start, end, bound),
+                                 this->ResizeStart(start, end, bound, bound < start), "TryGrowStart");
+                    break;
+                case 11:
+                    this->Expect(this->tree.TryShrinkStart(start, end, bound),
+                                 this->ResizeStart(start, end, bound, start < bound), "TryShrinkStart");
+                    break;
+                case 12:
+                    this->Expect(this->Catch([&] { this->tree.Split(start, end, bound); }),
+                                 this->Split(start, end, bound), "Split");
+                    break;
+                case 13:
+                {
+                    bool merged = false;
+                    UIT::Status status = this->Catch([&] { merged = this->tree.MergeWithNext(start, end); });
+                    bool expected_merged = false;
+                    this->Expect(status, this->MergeWithNext(start, end, expected_merged), "MergeWithNext");
+                    this->Expect(merged == expected_merged, "MergeWithNext result");
+                    break;
+                }
+                case 14:
+                {
+                    uint64_t window_end = start + (c % 128) + 1;
+                    std::size_t merges = this->tree.Coalesce(start, window_end);
+                    this->Expect(merges == this->Coalesce(start, window_end), "Coalesce count");
+                    break;
+                }
+                default:
+                    // Queries only
+                    break;
+            }
+            this->Query(a % Differential<Tree>::window + Differential<Tree>::base, start, end);
+        }
+
+        // Full comparison, the tree's own invariants plus an in-order walk against the reference
+        void Check()
+        {
+            try
+            {
+                this->tree.Verify("Differential");
+            }
+            catch (const UIT::InternalError& error)
+            {
+                this->Fail(error.what());
+            }
+            this->Expect(this->tree.size() == this->reference.size(), "size");
+            // Order statistics are checked here rather than per step, the reference needs O(n) to rank a point
+            typename Reference::const_iterator expected = this->reference.begin();
+            std::size_t index = 0;
+            for (auto it = this->tree.begin(); it != this->tree.end(); ++it, ++expected, ++index)
+            {
+                this->Expect(expected != this->reference.end() && it->range_start == expected->first &&
+                             it->range_end == expected->second.first && it->range_value == expected->second.second,
+                             "in-order walk");
+                this->Expect(this->tree.Select(index) == it, "Select");
+                this->Expect(this->tree.Rank(it->range_start) == index && this->tree.Rank(it->range_end) == index + 1,
+                             "Rank");
+            }
+            this->Expect(this->tree.Select(index) == this->tree.end(), "Select past the end");
+            this->Expect(expected == this->reference.end(), "in-order walk length");
+            if (!this->reference.empty())
+            {
+                this->Expect(this->tree.rbegin()->range_start == this->reference.rbegin()->first, "last range");
+            }
+        }
+
+    private:
+        // An existing range near a if asked to, so modifiers hit, otherwise an arbitrary one
+        void Pick(uint16_t a, uint16_t b, bool existing, uint64_t& start, uint64_t& end) const
+        {
+            start = a % Differential<Tree>::window + Differential<Tree>::base;
+            end = start + b % 32 + 1;
+            if (existing && !this->reference.empty())
+            {
+                typename Reference::const_iterator it = this->reference.lower_bound(start);
+                if (it == this->reference.end())
+                {
+                    it = this->reference.begin();
+                }
+                start = it->first;
+                end = it->second.first;
+            }
+        }
+
+        // Last range starting before point, or end()
+        typename Reference::iterator Before(uint64_t point)
+        {
+            typename Reference::iterator it = this->reference.lower_bound(point);
+            return it == this->reference.begin()? this->reference.end() : std::prev(it);
+        }
+
+        bool Overlaps(uint64_t start, uint64_t end)
+        {
+            typename Reference::iterator it = this->Before(end);
+            return it != this->reference.end() && start < it->second.first;
+        }
+
+        // The stored range [start, end) exactly, or end()
+        typename Reference::iterator Exact(uint64_t start, uint64_t end)
+        {
+            typename Reference::iterator it = this->reference.find(start);
+            return (it != this->reference.end() && it->second.first == end)? it : this->reference.end();
+        }
+
+        UIT::Status Insert(uint64_t start, uint64_t end, uint64_t value)
+        {
+            if (!(start < end))
+            {
+                return UIT::Status::INVALID_RANGE;
+            }
+            if (this->Overlaps(start, end))
+            {
+                return UIT::Status::RANGE_EXISTS;
+            }
+            this->reference[start] = std::make_pair(end, value);
+            return UIT::Status::SUCCESS;
+        }
+
+        UIT::Status Delete(uint64_t start, uint64_t end)
+        {
+            typename Reference::iterator it = this->Exact(start, end);
+            if (it == this->reference.end())
+            {
+                return UIT::Status::RANGE_NOT_FOUND;
+            }
+            this->reference.erase(it);
+            return UIT::Status::SUCCESS;
+        }
+
+        // direction is whether the modifier accepts a bound on this side, both keep the range non-empty
+        UIT::Status ResizeEnd(uint64_t start, uint64_t end, uint64_t new_end, bool direction)
+        {
+            if (!direction || !(start < end) || !(start < new_end))
+            {
+                return UIT::Status::INVALID_RANGE;
+            }
+            typename Reference::iterator it = this->Exact(start, end);
+            if (it == this->reference.end())
+            {
+                return UIT::Status::RANGE_NOT_FOUND;
+            }
+            typename Reference::iterator next = std::next(it);
+            if (end < new_end && next != this->reference.end() && next->first < new_end)
+            {
+                return UIT::Status::RANGE_EXISTS;
+            }
+            it->second.first = new_end;
+            return UIT::Status::SUCCESS;
+        }
+
+        UIT::Status ResizeStart(uint64_t start, uint64_t end, uint64_t new_start, bool direction)
+        {
+            if (!direction || !(start < end) || !(new_start < end))
+            {
+                return UIT::Status::INVALID_RANGE;
+            }
+            typename Reference::iterator it = this->Exact(start, end);
+            if (it == this->reference.end())
+            {
+                return UIT::Status::RANGE_NOT_FOUND;
+            }
+            typename Reference::iterator previous = this->Before(start);
+            if (new_start < start && previous != this->reference.end() && new_start < previous->second.first)
+            {
+                return UIT::Status::RANGE_EXISTS;
+            }
+            std::pair<uint64_t, uint64_t> range = it->second;
+            this->reference.erase(it);
+            this->reference[new_start] = range;
+            return UIT::Status::SUCCESS;
+        }
+
+        UIT::Status Split(uint64_t start, uint64_t end, uint64_t at)
+        {
+            if (!(start < at) || !(at < end))
+            {
+                return UIT::Status::INVALID_RANGE;
+            }
+            typename Reference::iterator it = this->Exact(start, end);
+            if (it == this->reference.end())
+            {
+                return UIT::Status::RANGE_NOT_FOUND;
+            }
+            it->second.first = at;
+            this->reference[at] = std::make_pair(end, it->second.second);
+            return UIT::Status::SUCCESS;
+        }
+
+        UIT::Status MergeWithNext(uint64_t start, uint64_t end, bool& merged)
+        {
+            if (!(start < end))
+            {
+                return UIT::Status::INVALID_RANGE;
+            }
+            typename Reference::iterator it = this->Exact(start, end);
+            if (it == this->reference.end())
+            {
+                return UIT::Status::RANGE_NOT_FOUND;
+            }
+            typename Reference::iterator next = std::next(it);
+            merged = next != this->reference.end() && next->first == end;
+            if (merged)
+            {
+                it->second.first = next->second.first;
+                this->reference.erase(next);
+            }
+            return UIT::Status::SUCCESS;
+        }
+
+        std::size_t Coalesce(uint64_t start, uint64_t end)
+        {
+            std::size_t merges = 0;
+            typename Reference::iterator it = this->Before(start);
+            if (it == this->reference.end() || !(start < it->second.first))
+            {
+                it = this->reference.lower_bound(start);
+            }
+            while (it != this->reference.end() && it->first < end)
+            {
+                typename Reference::iterator next = std::next(it);
+                if (next == this->reference.end() || !(next->first < end))
+                {
+                    break;
+                }
+                if (next->first == it->second.first && next->second.second == it->second.second)
+                {
+                    it->second.first = next->second.first;
+                    this->reference.erase(next);
+                    ++merges;
+                }
+                else
+                {
+                    it = next;
+                }
+            }
+            return merges;
+        }
+
+        // Lookups and overlap queries around the step's arguments
+        void Query(uint64_t point, uint64_t start, uint64_t end)
+        {
+            typename Reference::iterator containing = this->Before(point + 1);
+            bool has = containing != this->reference.end() && point < containing->second.first;
+            this->Expect(this->tree.Has(point) == has, "Has(point)");
+            uint64_t found_start = 0, found_end = 0;
+            uint64_t* value = nullptr;
+            bool found = this->tree.Access(point, found_start, found_end, value);
+            this->Expect(found == has, "Access(point)");
+            if (has)
+            {
+                this->Expect(found_start == containing->first && found_end == containing->second.first &&
+                             *value == containing->second.second, "Access(point) range");
+            }
+            if (!(start < end))
+            {
+                return;
+            }
+            this->Expect(this->tree.Has(start, end) == this->Overlaps(start, end), "Has(range)");
+            std::size_t overlapping = 0;
+            typename Reference::iterator first = this->Before(start);
+            if (first == this->reference.end() || !(start < first->second.first))
+            {
+                first = this->reference.lower_bound(start);
+            }
+            for (; first != this->reference.end() && first->first < end; ++first)
+            {
+                ++overlapping;
+            }
+            this->Expect(this->tree.CountOverlapping(start, end) == overlapping, "CountOverlapping");
+        }
+
+        // Runs a throwing modifier and maps its exception back to the Status the Try API would return
+        template <class Function>
+        static UIT::Status Catch(Function function)
+        {
+            try
+            {
+                function();
+            }
+            catch (const UIT::InvalidRangeException<uint64_t>&)
+            {
+                return UIT::Status::INVALID_RANGE;
+            }
+            catch (const UIT::RangeNotFound<uint64_t>&)
+            {
+                return UIT::Status::RANGE_NOT_FOUND;
+            }
+            catch (const UIT::RangeExists<uint64_t>&)
+            {
+                return UIT::Status::RANGE_EXISTS;
+            }
+            return UIT::Status::SUCCESS;
+        }
+
+        void Expect(UIT::Status status, UIT::Status expected, const char* what)
+        {
+            if (status != expected)
+            {
+                std::ostringstream ss;
+                ss << what << " returned " << static_cast<int>(status) << " instead of " << static_cast<int>(expected);
+                this->Fail(ss.str());
+            }
+        }
+
+        void Expect(bool expr, const char* what)
+        {
+            if (!expr)
+            {
+                this->Fail(std::string(what) + " differs from the reference");
+            }
+        }
+
+        void Fail(const std::string& what)
+        {
+            std::ostringstream ss;
+            ss << what << " at step " << this->steps << ", tree:\n" << this->tree.ToString();
+            throw std::logic_error(ss.str());
+        }
+};
+
+template <class Tree>
+constexpr uint64_t Differential<Tree>::base;
+template <class Tree>
+constexpr uint64_t Differential<Tree>::window;
+template <class Tree>
+constexpr int Differential<Tree>::operations;
+
+#endif // _UNIQUEINTERVALTREE_TEST_DIFFERENTIAL_HPP_
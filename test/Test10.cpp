@@ -0,0 +1,102 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <iostream>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+using Ranges = std::vector<std::pair<uint64_t, uint64_t>>;
+
+void check(bool expr, const char* what, uint64_t start, uint64_t end)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " for query [" << start << ", " << end << ")\n";
+        exit(1);
+    }
+}
+
+// Brute force reference, every mirrored range that overlaps the query, in order
+Ranges Expected(const std::map<uint64_t, uint64_t>& mirror, uint64_t start, uint64_t end)
+{
+    Ranges ranges;
+    for (const auto& range : mirror)
+    {
+        if (range.first < end && start < range.second)
+        {
+            ranges.emplace_back(range.first, range.second);
+        }
+    }
+    return ranges;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    std::mt19937_64 rng(13);
+    UIT::Tree<uint64_t, uint64_t> map;
+    std::map<uint64_t, uint64_t> mirror;
+    for (uint64_t i = 0; i < 3000; ++i)
+    {
+        uint64_t key = rng() % 10000;
+        uint64_t value = key;
+        if (!map.Has(key * 10, key * 10 + 10))
+        {
+            map.Insert(key * 10, key * 10 + 1 + key % 9, value);
+            mirror[key * 10] = key * 10 + 1 + key % 9;
+        }
+    }
+
+    for (int round = 0; round < 20000; ++round)
+    {
+        uint64_t start = rng() % 100020;
+        uint64_t end = start + 1 + (round % 4 == 0? rng() % 5000 : rng() % 40);
+        Ranges expected = Expected(mirror, start, end);
+
+        Ranges visited;
+        std::size_t count = map.ForEachOverlapping(start, end, [&visited](const uint64_t& s, const uint64_t& e,
+                                                                          uint64_t& value)
+        {
+            visited.emplace_back(s, e);
+            value = s;
+        });
+        check(count == expected.size() && visited == expected, "visitor mismatch", start, end);
+
+        const UIT::Tree<uint64_t, uint64_t>& const_map = map;
+        Ranges iterated;
+        auto overlapping = const_map.Overlapping(start, end);
+        for (auto it = overlapping.first; it != overlapping.second; ++it)
+        {
+            check(it->range_value == it->range_start, "visitor did not write the value", start, end);
+            iterated.emplace_back(it->range_start, it->range_end);
+        }
+        check(iterated == expected, "iterator mismatch", start, end);
+        check(!expected.empty() == map.Has(start, end), "disagrees with Has", start, end);
+
+        // Keep changing the tree so the max pruning sees deletions and resizes
+        if (!expected.empty() && round % 7 == 0)
+        {
+            std::pair<uint64_t, uint64_t> range = expected[rng() % expected.size()];
+            if (round % 3 == 0)
+            {
+                map.Delete(range.first, range.second);
+                mirror.erase(range.first);
+            }
+            else if (range.second - range.first > 1)
+            {
+                map.ShrinkEnd(range.first, range.second, range.second - 1);
+                mirror[range.first] = range.second - 1;
+            }
+            else if (!map.Has(range.second, range.second + 1))
+            {
+                map.GrowEnd(range.first, range.second, range.second + 1);
+                mirror[range.first] = range.second + 1;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,130 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <iostream>
+#include <random>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+// FindGap walks the Gaps augmentation, which the tree has to be declared with
+using GapTree = UIT::Tree<uint64_t, uint64_t, std::allocator<UIT::Node<uint64_t, uint64_t>>, UIT::Gaps<uint64_t>>;
+
+void check(bool expr, const char* what, uint64_t size, uint64_t hint)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " for size " << size << " and hint " << hint << "\n";
+        exit(1);
+    }
+}
+
+// Linear reference, the first free address at or after hint followed by min_size free addresses
+uint64_t ExpectedGap(const GapTree& map, uint64_t min_size, uint64_t hint)
+{
+    uint64_t start = hint;
+    for (const auto& node : map)
+    {
+        if (node.range_end <= start)
+        {
+            continue;
+        }
+        if (node.range_start >= start && node.range_start - start >= min_size)
+        {
+            return start;
+        }
+        start = node.range_end;
+    }
+    return start;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    std::mt19937_64 rng(17);
+    GapTree map;
+    check(map.FindGap(10, 5) == 5, "empty tree", 10, 5);
+    for (uint64_t i = 0; i < 2000; ++i)
+    {
+        uint64_t key = rng() % 10000;
+        uint64_t value = key;
+        uint64_t start = key * 10;
+        uint64_t end = start + 1 + rng() % 10;
+        if (!map.Has(start, end))
+        {
+            map.Insert(start, end, value);
+        }
+    }
+
+    for (int round = 0; round < 20000; ++round)
+    {
+        uint64_t min_size = 1 + rng() % (round % 2? 12 : 120);
+        uint64_t hint = rng() % 100100;
+        check(map.FindGap(min_size, hint) == ExpectedGap(map, min_size, hint), "wrong gap", min_size, hint);
+
+        // Reshape the tree as we go, so every kind of update has to keep the gaps right
+        uint64_t point = rng() % 100000;
+        uint64_t start, end;
+        uint64_t* value;
+        if (map.Access(point, start, end, value))
+        {
+            switch (round % 5)
+            {
+                case 0:
+                    map.Delete(start, end);
+                    break;
+                case 1:
+                    if (end - start > 1)
+                    {
+                        map.ShrinkStart(start, end, start + 1);
+                    }
+                    break;
+                case 2:
+                    if (end - start > 1)
+                    {
+                        map.ShrinkEnd(start, end, end - 1);
+                    }
+                    break;
+                case 3:
+                    if (start > 0 && !map.Has(start - 1))
+                    {
+                        map.GrowStart(start, end, start - 1);
+                    }
+                    break;
+                case 4:
+                    if (!map.Has(end))
+                    {
+                        map.GrowEnd(start, end, end + 1);
+                    }
+                    break;
+            }
+        }
+        else if (round % 3 == 0)
+        {
+            uint64_t value = point;
+            map.Insert(point, point + 1, value);
+        }
+    }
+
+    GapTree clone = map.Clone();
+    for (uint64_t hint = 0; hint < 100100; hint += 37)
+    {
+        check(clone.FindGap(25, hint) == ExpectedGap(map, 25, hint), "wrong gap in clone", 25, hint);
+    }
+
+    // Gaps also works as one part of a Join
+    using Joined = UIT::Join<UIT::TotalLength<uint64_t>, UIT::Gaps<uint64_t>>;
+    UIT::Tree<uint64_t, uint64_t, std::allocator<UIT::Node<uint64_t, uint64_t>>, Joined> joined;
+    uint64_t total = 0;
+    for (const auto& node : map)
+    {
+        uint64_t value = node.range_value;
+        joined.Insert(node.range_start, node.range_end, value);
+        total += node.range_end - node.range_start;
+    }
+    check(joined.Reduce(0, 100100).first == total, "wrong total length next to the gaps", 0, 0);
+    for (uint64_t hint = 0; hint < 100100; hint += 37)
+    {
+        check(joined.FindGap(25, hint) == ExpectedGap(map, 25, hint), "wrong gap in a join", 25, hint);
+    }
+    return 0;
+}
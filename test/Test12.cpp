@@ -0,0 +1,119 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <iostream>
+#include <map>
+#include <random>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+// Order statistics walk the Counts augmentation, which the tree has to be declared with
+using CountedTree = UIT::Tree<uint64_t, uint64_t, std::allocator<UIT::Node<uint64_t, uint64_t>>, UIT::Counts>;
+
+void check(bool expr, const char* what, uint64_t value)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " at " << value << "\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    std::mt19937_64 rng(19);
+    CountedTree map;
+    std::map<uint64_t, uint64_t> mirror;
+    check(map.Select(0) == map.end() && map.Rank(10) == 0 && map.CountOverlapping(0, 10) == 0, "empty tree", 0);
+
+    for (int round = 0; round < 30000; ++round)
+    {
+        // Mostly grow the tree, while removing and resizing ranges to rotate it around
+        uint64_t point = rng() % 50000;
+        uint64_t start, end;
+        uint64_t* value;
+        if (!map.Access(point, start, end, value))
+        {
+            if (round % 4 != 3)
+            {
+                uint64_t new_value = point;
+                uint64_t new_end = point + 1;
+                while (new_end < point + 8 && !map.Has(new_end))
+                {
+                    ++new_end;
+                }
+                map.Insert(point, new_end, new_value);
+                mirror[point] = new_end;
+            }
+        }
+        else if (round % 3 == 0)
+        {
+            map.Delete(start, end);
+            mirror.erase(start);
+        }
+        else if (end - start > 1)
+        {
+            map.ShrinkStart(start, end, start + 1);
+            mirror.erase(start);
+            mirror[start + 1] = end;
+        }
+
+        if (round % 50 != 0)
+        {
+            continue;
+        }
+        check(map.size() == mirror.size(), "size mismatch", round);
+        std::size_t index = 0;
+        for (const auto& range : mirror)
+        {
+            auto it = map.Select(index);
+            check(it != map.end() && it->range_start == range.first && it->range_end == range.second,
+                  "wrong range selected", index);
+            ++index;
+        }
+        check(map.Select(index) == map.end(), "selected past the end", index);
+        for (int query = 0; query < 20; ++query)
+        {
+            uint64_t a = rng() % 50010;
+            uint64_t b = a + 1 + rng() % 2000;
+            std::size_t rank = 0, overlapping = 0;
+            for (const auto& range : mirror)
+            {
+                rank += range.first < a;
+                overlapping += range.first < b && a < range.second;
+            }
+            check(map.Rank(a) == rank, "wrong rank", a);
+            check(map.CountOverlapping(a, b) == overlapping, "wrong overlap count", a);
+        }
+    }
+
+    CountedTree clone = map.Clone();
+    const CountedTree& const_clone = clone;
+    std::size_t index = 0;
+    for (const auto& range : mirror)
+    {
+        check(const_clone.Select(index)->range_start == range.first, "wrong range selected in clone", index);
+        ++index;
+    }
+
+    // Counts also works as one part of a Join
+    using Joined = UIT::Join<UIT::Counts, UIT::TotalLength<uint64_t>>;
+    UIT::Tree<uint64_t, uint64_t, std::allocator<UIT::Node<uint64_t, uint64_t>>, Joined> joined;
+    uint64_t total = 0;
+    for (const auto& node : map)
+    {
+        uint64_t value = node.range_value;
+        joined.Insert(node.range_start, node.range_end, value);
+        total += node.range_end - node.range_start;
+    }
+    check(joined.Reduce(0, 60000).second == total, "wrong total length next to the counts", 0);
+    index = 0;
+    for (const auto& range : mirror)
+    {
+        check(joined.Select(index)->range_start == range.first && joined.Rank(range.first) == index,
+              "wrong order statistics in a join", index);
+        ++index;
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <utility>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+void check(bool expr, const char* what, uint64_t start, uint64_t end)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " for window [" << start << ", " << end << ")\n";
+        exit(1);
+    }
+}
+
+// Not commutative, so any misordering of the combination shows up: keeps the first and the last start in the window
+struct FirstLast
+{
+    using value_type = std::pair<uint64_t, uint64_t>;
+
+    static value_type Identity()
+    {
+        return value_type(std::numeric_limits<uint64_t>::max(), std::numeric_limits<uint64_t>::max());
+    }
+
+    static value_type Lift(const uint64_t& range_start, const uint64_t&, const uint64_t&)
+    {
+        return value_type(range_start, range_start);
+    }
+
+    static value_type Combine(const value_type& left, const value_type& right)
+    {
+        if (left.first == std::numeric_limits<uint64_t>::max())
+        {
+            return right;
+        }
+        if (right.first == std::numeric_limits<uint64_t>::max())
+        {
+            return left;
+        }
+        return value_type(left.first, right.second);
+    }
+};
+
+using Ranges = std::map<uint64_t, std::pair<uint64_t, uint64_t>>;
+
+template <class Tree>
+void Fill(Tree& map, Ranges& mirror, std::mt19937_64& rng)
+{
+    for (int i = 0; i < 3000; ++i)
+    {
+        uint64_t start = (rng() % 10000) * 10;
+        uint64_t end = start + 1 + rng() % 9;
+        uint64_t value = rng() % 1000;
+        if (!map.Has(start, end))
+        {
+            map.Insert(start, end, value);
+            mirror[start] = std::make_pair(end, value);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    std::mt19937_64 rng(23);
+    // The pool allocator is declared for plain nodes, the tree rebinds it to its augmented ones
+    using Pool = UIT::PoolAllocator<UIT::Node<uint64_t, uint64_t>>;
+    UIT::Tree<uint64_t, uint64_t, Pool, UIT::TotalLength<uint64_t>> lengths;
+    UIT::Tree<uint64_t, uint64_t, std::allocator<UIT::Node<uint64_t, uint64_t>>, UIT::MaxValue<uint64_t>> hottest;
+    UIT::Tree<uint64_t, uint64_t, std::allocator<UIT::Node<uint64_t, uint64_t>>, FirstLast> order;
+    Ranges mirror_lengths, mirror_hottest, mirror_order;
+    Fill(lengths, mirror_lengths, rng);
+    Fill(hottest, mirror_hottest, rng);
+    Fill(order, mirror_order, rng);
+
+    for (int round = 0; round < 5000; ++round)
+    {
+        uint64_t a = rng() % 100010;
+        uint64_t b = a + 1 + (round % 2? rng() % 50 : rng() % 20000);
+        uint64_t total = 0, max = 0;
+        std::pair<uint64_t, uint64_t> first_last = FirstLast::Identity();
+        for (const auto& range : mirror_lengths)
+        {
+            total += range.first < b && a < range.second.first? range.second.first - range.first : 0;
+        }
+        for (const auto& range : mirror_hottest)
+        {
+            max = range.first < b && a < range.second.first? std::max(max, range.second.second) : max;
+        }
+        for (const auto& range : mirror_order)
+        {
+            if (range.first < b && a < range.second.first)
+            {
+                first_last = FirstLast::Combine(first_last, FirstLast::Lift(range.first, 0, 0));
+            }
+        }
+        check(lengths.Reduce(a, b) == total, "wrong total length", a, b);
+        check(hottest.Reduce(a, b) == max, "wrong max value", a, b);
+        check(order.Reduce(a, b) == first_last, "wrong order of combination", a, b);
+
+        // Change the trees between queries: delete, resize and bump values in place
+        uint64_t start, end;
+        uint64_t* value;
+        if (lengths.Access(a, start, end, value))
+        {
+            if (round % 2)
+            {
+                lengths.Delete(start, end);
+                mirror_lengths.erase(start);
+            }
+            else if (end - start > 1)
+            {
+                lengths.ShrinkEnd(start, end, end - 1);
+                mirror_lengths[start].first = end - 1;
+            }
+        }
+        if (hottest.Access(a, start, end, value))
+        {
+            *value += 1 + rng() % 1000;
+            hottest.Refresh(a);
+            mirror_hottest[start].second = *value;
+        }
+        if (order.Access(a, start, end, value) && end - start > 1)
+        {
+            order.ShrinkStart(start, end, start + 1);
+            mirror_order[start + 1] = mirror_order[start];
+            mirror_order.erase(start);
+        }
+    }
+    auto clone = lengths.Clone();
+    check(clone.Reduce(0, 200000) == lengths.Reduce(0, 200000), "clone lost the aggregate", 0, 200000);
+    return 0;
+}
@@ -0,0 +1,211 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <utility>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+using Node = UIT::Node<uint64_t, uint64_t>;
+using Ranges = std::map<uint64_t, std::pair<uint64_t, uint64_t>>;
+
+// Fails every allocation while fail_allocations is set
+bool fail_allocations = false;
+
+template <class T>
+struct FailingAllocator
+{
+    using value_type = T;
+
+    FailingAllocator() = default;
+
+    template <class U>
+    FailingAllocator(const FailingAllocator<U>&)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (fail_allocations)
+        {
+            throw std::bad_alloc();
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* pointer, std::size_t n)
+    {
+        std::allocator<T>().deallocate(pointer, n);
+    }
+};
+
+template <class T, class U>
+bool operator==(const FailingAllocator<T>&, const FailingAllocator<U>&)
+{
+    return true;
+}
+
+template <class T, class U>
+bool operator!=(const FailingAllocator<T>&, const FailingAllocator<U>&)
+{
+    return false;
+}
+
+void check(bool expr, const char* what, int round)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " in round " << round << "\n";
+        exit(1);
+    }
+}
+
+bool Same(const UIT::Tree<uint64_t, uint64_t>& map, const Ranges& mirror)
+{
+    if (map.size() != mirror.size())
+    {
+        return false;
+    }
+    auto expected = mirror.begin();
+    for (const Node& node : map)
+    {
+        if (node.range_start != expected->first || node.range_end != expected->second.first ||
+            node.range_value != expected->second.second)
+        {
+            return false;
+        }
+        ++expected;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    std::mt19937_64 rng(29);
+    UIT::Tree<uint64_t, uint64_t> map;
+    Ranges mirror;
+    // Start from a few long regions that get chopped up and glued back together
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        uint64_t value = i % 3;
+        map.Insert(i * 1000, i * 1000 + 900, value);
+        mirror[i * 1000] = std::make_pair(i * 1000 + 900, value);
+    }
+
+    bool threw = false;
+    try
+    {
+        map.Split(0, 900, 900);
+    }
+    catch (const UIT::InvalidRangeException<uint64_t>&)
+    {
+        threw = true;
+    }
+    check(threw, "split at the end accepted", 0);
+    check(!map.MergeWithNext(0, 900), "merged with a gap in between", 0);
+
+    for (int round = 0; round < 20000; ++round)
+    {
+        uint64_t point = rng() % 100000;
+        uint64_t start, end;
+        uint64_t* value;
+        if (!map.Access(point, start, end, value))
+        {
+            continue;
+        }
+        if (round % 3 != 2 && point > start)
+        {
+            map.Split(start, end, point);
+            map.Access(point) = point % 3;
+            mirror[start].first = point;
+            mirror[point] = std::make_pair(end, point % 3);
+            check(map.Access(point) == point % 3 && map.Access(start) == mirror[start].second, "split values",
+                  round);
+        }
+        else if (round % 3 == 2 && round % 2)
+        {
+            auto next = mirror.find(end);
+            check(map.MergeWithNext(start, end) == (next != mirror.end()), "merge result", round);
+            if (next != mirror.end())
+            {
+                mirror[start].first = next->second.first;
+                mirror.erase(next);
+            }
+        }
+        else if (round % 3 == 2)
+        {
+            uint64_t window_end = start + 1 + rng() % 5000;
+            std::size_t merges = map.Coalesce(start, window_end);
+            std::size_t expected = 0;
+            for (auto it = mirror.find(start); it != mirror.end() && it->first < window_end;)
+            {
+                auto next = std::next(it);
+                if (next != mirror.end() && next->first < window_end && next->first == it->second.first &&
+                    next->second.second == it->second.second)
+                {
+                    it->second.first = next->second.first;
+                    mirror.erase(next);
+                    ++expected;
+                }
+                else
+                {
+                    it = next;
+                }
+            }
+            check(merges == expected, "wrong number of merges", round);
+        }
+        map.Verify("Test14 round");
+        if (round % 100 == 0)
+        {
+            check(Same(map, mirror), "tree does not match the mirror", round);
+        }
+    }
+    check(Same(map, mirror), "tree does not match the mirror", 20000);
+    check(map.begin()->range_start == mirror.begin()->first &&
+          (--map.end())->range_start == mirror.rbegin()->first, "ends not tracked", 20000);
+
+    // Moving a start into the previous range is refused and leaves the tree as it was
+    auto second = std::next(mirror.begin());
+    threw = false;
+    try
+    {
+        map.GrowStart(second->first, second->second.first, mirror.begin()->second.first - 1);
+    }
+    catch (const UIT::RangeExists<uint64_t>&)
+    {
+        threw = true;
+    }
+    check(threw && Same(map, mirror), "conflicting grow start", 20000);
+    map.GrowStart(second->first, second->second.first, mirror.begin()->second.first);
+    map.ShrinkStart(mirror.begin()->second.first, second->second.first, second->first);
+    map.Verify("Test14 moved starts");
+    check(Same(map, mirror), "start moved back and forth", 20000);
+
+    // A split whose new node cannot be allocated leaves the range whole
+    UIT::Tree<uint64_t, uint64_t, FailingAllocator<Node>> failing;
+    uint64_t value = 7;
+    failing.Insert(0, 100, value);
+    failing.Insert(200, 300, value);
+    fail_allocations = true;
+    threw = false;
+    try
+    {
+        failing.Split(0, 100, 50);
+    }
+    catch (const std::bad_alloc&)
+    {
+        threw = true;
+    }
+    fail_allocations = false;
+    failing.Verify("Test14 failed split");
+    uint64_t start, end;
+    check(threw && failing.size() == 2 && failing.Access(75, start, end) == 7 && start == 0 && end == 100,
+          "failed split changed the tree", 0);
+    return 0;
+}
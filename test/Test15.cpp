@@ -0,0 +1,88 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <random>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+// Counts lets the hints below be picked with Select and Rank
+using Node = UIT::Node<uint64_t, uint64_t, UIT::Counts>;
+using Map = UIT::Tree<uint64_t, uint64_t, std::allocator<Node>, UIT::Counts>;
+
+void check(bool expr, const char* what, uint64_t point)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " at " << point << "\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    // Appends with end() as the hint, like a bump allocator
+    Map map;
+    for (uint64_t i = 0; i < 10000; ++i)
+    {
+        uint64_t value = i;
+        auto it = map.Insert(map.end(), i * 10, i * 10 + 5, value);
+        check(it->range_start == i * 10 && it->range_value == i, "wrong iterator returned", i);
+        check(std::next(it) == map.end(), "append not at the end", i);
+    }
+    map.Verify("Test15 appends");
+    check(map.size() == 10000, "appends broke the tree", 0);
+
+    // Random hints, right or wrong, must all end up in the same tree as plain inserts
+    std::mt19937_64 rng(31);
+    std::map<uint64_t, uint64_t> mirror;
+    for (uint64_t i = 0; i < 10000; ++i)
+    {
+        mirror[i * 10] = i * 10 + 5;
+    }
+    for (int round = 0; round < 20000; ++round)
+    {
+        uint64_t start = rng() % 100000;
+        uint64_t end = start + 1 + rng() % 4;
+        if (map.Has(start, end))
+        {
+            continue;
+        }
+        uint64_t value = start;
+        // The right spot (the first range starting after the new one), a random range, or the end
+        auto hint = round % 3 == 0? map.Select(map.Rank(start)) : round % 3 == 1? map.Select(rng() % map.size()) :
+                                                                                   map.end();
+        auto it = round % 2? map.Insert(hint, start, end, value) : map.Insert(hint, start, end);
+        mirror[start] = end;
+        check(it->range_start == start && it->range_end == end, "wrong iterator returned", start);
+        if (round % 1000 == 0)
+        {
+            map.Verify("Test15 hinted inserts");
+        }
+    }
+    check(map.size() == mirror.size(), "size mismatch", 0);
+    auto expected = mirror.begin();
+    for (const Node& node : map)
+    {
+        check(node.range_start == expected->first && node.range_end == expected->second, "wrong order",
+              node.range_start);
+        ++expected;
+    }
+
+    // Overlaps are still refused, whatever the hint
+    bool threw = false;
+    try
+    {
+        uint64_t value = 0;
+        map.Insert(map.begin(), 0, 3, value);
+    }
+    catch (const UIT::RangeExists<uint64_t>&)
+    {
+        threw = true;
+    }
+    check(threw, "overlap accepted through a hint", 0);
+    return 0;
+}
@@ -0,0 +1,143 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+void check(bool expr, const char* what, int round)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " in round " << round << "\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    UIT::Tree<uint64_t, uint64_t> map;
+    uint64_t value = 1;
+    check(map.TryInsert(10, 20, value) == UIT::Status::SUCCESS, "insert", 0);
+    check(map.TryInsert(30, 40) == UIT::Status::SUCCESS, "insert without a value", 0);
+    check(map.TryInsert(15, 25, value) == UIT::Status::RANGE_EXISTS, "overlapping insert", 0);
+    check(map.TryInsert(25, 25, value) == UIT::Status::INVALID_RANGE, "empty insert", 0);
+    check(map.TryDelete(10, 15) == UIT::Status::RANGE_NOT_FOUND, "delete of a partial range", 0);
+    check(map.TryGrowEnd(10, 20, 31) == UIT::Status::RANGE_EXISTS, "grow end into the next range", 0);
+    check(map.TryGrowEnd(10, 20, 15) == UIT::Status::INVALID_RANGE, "grow end that shrinks", 0);
+    check(map.TryGrowEnd(10, 20, 30) == UIT::Status::SUCCESS, "grow end up to the next range", 0);
+    check(map.TryGrowStart(30, 40, 29) == UIT::Status::RANGE_EXISTS, "grow start into the previous range", 0);
+    check(map.TryShrinkStart(30, 40, 40) == UIT::Status::INVALID_RANGE, "shrink start to nothing", 0);
+    check(map.TryShrinkStart(30, 40, 35) == UIT::Status::SUCCESS, "shrink start", 0);
+    check(map.TryGrowStart(35, 40, 30) == UIT::Status::SUCCESS, "grow start up to the previous range", 0);
+    check(map.TryShrinkEnd(10, 30, 5) == UIT::Status::INVALID_RANGE, "shrink end below the start", 0);
+    check(map.TryShrinkEnd(10, 30, 20) == UIT::Status::SUCCESS, "shrink end", 0);
+    check(map.TryDelete(30, 40) == UIT::Status::SUCCESS && map.size() == 1 && map.Has(10, 20), "delete", 0);
+
+    // Random operations must succeed exactly when a mirror says they should, and fail without side effects
+    std::mt19937_64 rng(37);
+    std::map<uint64_t, uint64_t> mirror{{10, 20}};
+    for (int round = 1; round < 20000; ++round)
+    {
+        uint64_t start = rng() % 1000;
+        uint64_t end = start + rng() % 8;
+        uint64_t bound = start + rng() % 12 - 4;
+        auto it = mirror.find(start);
+        bool stored = it != mirror.end() && it->second == end;
+        auto next = mirror.upper_bound(start);
+        auto previous = mirror.lower_bound(start);
+        bool has_previous = previous != mirror.begin();
+        uint64_t previous_end = has_previous? std::prev(previous)->second : 0;
+        UIT::Status status;
+        UIT::Status expected;
+        switch (round % 4)
+        {
+            case 0:
+                status = map.TryInsert(start, end, value);
+                if (start >= end)
+                {
+                    expected = UIT::Status::INVALID_RANGE;
+                }
+                else if ((next != mirror.end() && next->first < end) || (has_previous && start < previous_end) ||
+                         it != mirror.end())
+                {
+                    expected = UIT::Status::RANGE_EXISTS;
+                }
+                else
+                {
+                    expected = UIT::Status::SUCCESS;
+                    mirror[start] = end;
+                }
+                break;
+            case 1:
+                status = map.TryDelete(start, end);
+                expected = start >= end? UIT::Status::INVALID_RANGE :
+                           stored? UIT::Status::SUCCESS : UIT::Status::RANGE_NOT_FOUND;
+                if (expected == UIT::Status::SUCCESS)
+                {
+                    mirror.erase(start);
+                }
+                break;
+            case 2:
+                status = map.TryGrowEnd(start, end, bound);
+                expected = start >= end || bound <= end? UIT::Status::INVALID_RANGE :
+                           !stored? UIT::Status::RANGE_NOT_FOUND :
+                           next != mirror.end() && next->first < bound? UIT::Status::RANGE_EXISTS :
+                           UIT::Status::SUCCESS;
+                if (expected == UIT::Status::SUCCESS)
+                {
+                    mirror[start] = bound;
+                }
+                break;
+            default:
+                status = map.TryGrowStart(start, end, bound);
+                expected = start >= end || bound >= start? UIT::Status::INVALID_RANGE :
+                           !stored? UIT::Status::RANGE_NOT_FOUND :
+                           has_previous && bound < previous_end? UIT::Status::RANGE_EXISTS : UIT::Status::SUCCESS;
+                if (expected == UIT::Status::SUCCESS)
+                {
+                    mirror.erase(start);
+                    mirror[bound] = end;
+                }
+                break;
+        }
+        check(status == expected, "unexpected status", round);
+        check(map.size() == mirror.size(), "size mismatch", round);
+    }
+    auto expected = mirror.begin();
+    for (const auto& node : map)
+    {
+        check(node.range_start == expected->first && node.range_end == expected->second, "tree does not match",
+              0);
+        ++expected;
+    }
+
+    // Messages are only built when asked for, but must still say what happened
+    try
+    {
+        map.Access(5000);
+        check(false, "missing point found", 0);
+    }
+    catch (const UIT::PointNotFound<uint64_t>& e)
+    {
+        check(std::string(e.what()) == "Point 5000 was not found in the tree", "point message", 0);
+        check(e.what() == e.what(), "message built twice", 0);
+    }
+    try
+    {
+        map.Insert(mirror.begin()->first, mirror.begin()->second, value);
+        check(false, "overlap accepted", 0);
+    }
+    catch (const UIT::RangeExists<uint64_t>& e)
+    {
+        check(std::strstr(e.what(), "overlaps with existing range") != nullptr, "overlap message", 0);
+    }
+    UIT::RangeExists<uint64_t> at_zero(0, 5, 0, 3);
+    check(std::strstr(at_zero.what(), "existing range [0, 3)") != nullptr, "existing range at zero", 0);
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <iostream>
+#include <random>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+using Node = UIT::Node<uint64_t, uint64_t>;
+using DebugTree = UIT::Tree<uint64_t, uint64_t, std::allocator<Node>, UIT::NoAugment, UIT::Debug>;
+using UncheckedTree = UIT::Tree<uint64_t, uint64_t, std::allocator<Node>, UIT::NoAugment, UIT::Unchecked>;
+
+void check(bool expr, const char* what, int round)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " in round " << round << "\n";
+        exit(1);
+    }
+}
+
+template <class Exception, class Function>
+bool Throws(Function function)
+{
+    try
+    {
+        function();
+    }
+    catch (const Exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    // The debug tree verifies itself after every modification, any broken invariant would throw
+    std::mt19937_64 rng(41);
+    DebugTree debug;
+    UncheckedTree unchecked;
+    for (int round = 0; round < 20000; ++round)
+    {
+        uint64_t point = rng() % 20000;
+        uint64_t start, end;
+        uint64_t* value;
+        if (!debug.Access(point, start, end, value))
+        {
+            uint64_t new_value = point;
+            uint64_t unchecked_value = point;
+            if (!debug.Has(point, point + 2))
+            {
+                debug.Insert(point, point + 2, new_value);
+                unchecked.Insert(point, point + 2, unchecked_value);
+            }
+        }
+        else if (round % 3 == 0)
+        {
+            debug.Delete(start, end);
+            unchecked.Delete(start, end);
+        }
+        else if (round % 3 == 1 && !debug.Has(end))
+        {
+            debug.GrowEnd(start, end, end + 1);
+            unchecked.GrowEnd(start, end, end + 1);
+        }
+        else if (end - start > 1)
+        {
+            debug.ShrinkStart(start, end, start + 1);
+            unchecked.ShrinkStart(start, end, start + 1);
+        }
+        check(debug.size() == unchecked.size(), "checked and unchecked trees differ", round);
+    }
+    unchecked.Verify();
+
+    // Checked policies still validate arguments
+    check(Throws<UIT::InvalidRangeException<uint64_t>>([&debug]() { debug.Delete(10, 5); }), "bad range accepted", 0);
+
+    // Corruptions are caught and reported as internal errors
+    check(debug.root != nullptr, "empty tree", 0);
+    Node* node = debug.root;
+    while (node->left_child)
+    {
+        node = node->left_child;
+    }
+    ++node->max;
+    check(Throws<UIT::InternalError>([&debug]() { debug.Verify(); }), "stale max not caught", 0);
+    --node->max;
+    node->color = node->color == UIT::Color::RED? UIT::Color::BLACK : UIT::Color::RED;
+    check(Throws<UIT::InternalError>([&debug]() { debug.Verify(); }), "recolored leaf not caught", 0);
+    node->color = node->color == UIT::Color::RED? UIT::Color::BLACK : UIT::Color::RED;
+    debug.Verify();
+    return 0;
+}
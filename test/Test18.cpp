@@ -0,0 +1,61 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "UniqueIntervalTree/Tree.hpp"
+#include "Differential.hpp"
+
+// The harness checks order statistics, which need Counts, and a second augmentation rides along to keep Join honest
+using Augment = UIT::Join<UIT::TotalLength<uint64_t>, UIT::Counts>;
+using Node = UIT::Node<uint64_t, uint64_t, Augment>;
+using CheckedTree = UIT::Tree<uint64_t, uint64_t, std::allocator<Node>, Augment>;
+using PooledTree = UIT::Tree<uint64_t, uint64_t, UIT::PoolAllocator<Node>, Augment>;
+using DebugTree = UIT::Tree<uint64_t, uint64_t, std::allocator<Node>, Augment, UIT::Debug>;
+
+// Runs steps random operations against the reference, with a full comparison every check_every steps
+template <class Tree>
+void run(const char* name, uint64_t seed, uint64_t steps, uint64_t check_every, bool cache)
+{
+    Differential<Tree> differential;
+    if (cache)
+    {
+        differential.tree.EnableCache(64, 4);
+    }
+    std::mt19937_64 rng(seed);
+    try
+    {
+        for (uint64_t step = 0; step < steps; ++step)
+        {
+            uint64_t bits = rng();
+            differential.Step(bits, bits >> 8, bits >> 24, bits >> 40);
+            if (step % check_every == 0)
+            {
+                differential.Check();
+            }
+        }
+        differential.Check();
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "ERROR: " << name << " with seed " << seed << ": " << error.what() << "\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    uint64_t steps = argc > 1? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    uint64_t seed = argc > 2? std::strtoull(argv[2], nullptr, 10) : 1;
+
+    run<CheckedTree>("checked tree", seed, steps, 1000, false);
+    // The cache and the pool only change where nodes come from and how points are found, a shorter run covers them
+    run<CheckedTree>("cached tree", seed + 1, steps / 4, 1000, true);
+    run<PooledTree>("pooled tree", seed + 2, steps / 4, 1000, false);
+    // Debug verifies after every modification on its own
+    run<DebugTree>("debug tree", seed + 3, steps / 10, steps, false);
+    return 0;
+}
@@ -0,0 +1,115 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// The instrumentation is opt-in, this test is the only place that builds with it
+#define UIT_ENABLE_STATS
+
+#include <iostream>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+void check(bool expr, const char* what, uint64_t value)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << ", got " << value << "\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    UIT::Histogram histogram;
+    check(histogram.Quantile(0.5) == 0, "quantile of an empty histogram", histogram.Quantile(0.5));
+    histogram.Record(0);
+    histogram.Record(1);
+    histogram.Record(3);
+    histogram.Record(100);
+    check(histogram.buckets[0] == 1 && histogram.buckets[1] == 1 && histogram.buckets[2] == 1 &&
+          histogram.buckets[7] == 1, "histogram buckets", histogram.Count());
+    check(histogram.Quantile(0.5) == 4 && histogram.Quantile(1) == 128, "histogram quantiles", histogram.Quantile(0.5));
+
+    // Ascending inserts rotate and recolor all along the right spine
+    UIT::Tree<uint64_t, uint64_t> map;
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        uint64_t value = i;
+        map.Insert(i * 10, i * 10 + 5, value);
+    }
+    UIT::Stats stats = map.GetStats();
+    check(stats.rotations > 0 && stats.rotations < 1000, "rotations of ascending inserts", stats.rotations);
+    check(stats.insert_recolorings > 0, "recolorings of ascending inserts", stats.insert_recolorings);
+    check(stats.descents == 1000 && stats.lookups == 0, "descents of inserts", stats.descents);
+    check(stats.Latency(UIT::Operation::INSERT).Count() == 1000, "insert latencies",
+          stats.Latency(UIT::Operation::INSERT).Count());
+    check(stats.Latency(UIT::Operation::INSERT).Quantile(0.5) <= stats.Latency(UIT::Operation::INSERT).Quantile(0.99),
+          "insert latency quantiles", stats.Latency(UIT::Operation::INSERT).Quantile(0.5));
+
+    // Lookups of a balanced tree of 1000 ranges visit at most 2 * log2(1001) nodes each
+    map.ResetStats();
+    check(map.GetStats().rotations == 0 && map.GetStats().descents == 0, "reset", map.GetStats().rotations);
+    for (uint64_t i = 0; i < 1000; ++i)
+    {
+        check(map.Has(i * 10 + 2) && !map.Has(i * 10 + 7), "lookup result", i);
+    }
+    check(map.Has(500, 510), "range lookup result", 500);
+    stats = map.GetStats();
+    check(stats.lookups == 2001 && stats.descents == 2001, "lookups", stats.lookups);
+    check(stats.nodes_visited >= 2001 && stats.nodes_visited <= 2001 * 20, "nodes visited", stats.nodes_visited);
+    check(stats.Latency(UIT::Operation::LOOKUP).Count() == 2001, "lookup latencies",
+          stats.Latency(UIT::Operation::LOOKUP).Count());
+    check(stats.rotations == 0 && stats.throws == 0, "lookups changed the tree", stats.rotations);
+
+    // Cache hits are still lookups, they just skip the descent
+    map.ResetStats();
+    map.EnableCache(64, 4);
+    for (int i = 0; i < 10; ++i)
+    {
+        check(map.Has(32), "cached lookup result", i);
+    }
+    stats = map.GetStats();
+    check(stats.lookups == 10 && stats.cache_hits == 9 && stats.descents == 1, "cached lookups", stats.lookups);
+    check(stats.Latency(UIT::Operation::LOOKUP).Count() == 10, "cached lookup latencies",
+          stats.Latency(UIT::Operation::LOOKUP).Count());
+    map.EnableCache(0);
+
+    // Searches the tree runs for itself are descents, not lookups
+    map.Refresh(32);
+    stats = map.GetStats();
+    check(stats.lookups == 10 && stats.descents == 2, "internal search counted as a lookup", stats.lookups);
+
+    // Failures are counted whether they come from arguments, missing ranges or conflicts
+    map.ResetStats();
+    for (auto failure : {+[](UIT::Tree<uint64_t, uint64_t>& map) { map.Access(7); },
+                         +[](UIT::Tree<uint64_t, uint64_t>& map) { map.Delete(0, 4); },
+                         +[](UIT::Tree<uint64_t, uint64_t>& map) { map.GrowEnd(0, 5, 11); },
+                         +[](UIT::Tree<uint64_t, uint64_t>& map) { map.Insert(5, 5); }})
+    {
+        try
+        {
+            failure(map);
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+    stats = map.GetStats();
+    check(stats.throws == 4, "throws", stats.throws);
+    check(stats.Latency(UIT::Operation::DELETE).Count() == 1 && stats.Latency(UIT::Operation::RESIZE).Count() == 1,
+          "latencies of failed operations", stats.Latency(UIT::Operation::DELETE).Count());
+    check(map.TryDelete(0, 4) == UIT::Status::RANGE_NOT_FOUND && map.GetStats().throws == 4, "Try API throws",
+          map.GetStats().throws);
+
+    // Deleting every other range needs fix-ups
+    for (uint64_t i = 0; i < 1000; i += 2)
+    {
+        map.Delete(i * 10, i * 10 + 5);
+    }
+    check(map.GetStats().delete_recolorings > 0, "recolorings of deletes", map.GetStats().delete_recolorings);
+
+    // Counters follow the tree when it is moved
+    UIT::Tree<uint64_t, uint64_t> moved(std::move(map));
+    check(moved.GetStats().throws == 4, "stats after a move", moved.GetStats().throws);
+    return 0;
+}
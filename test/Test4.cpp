@@ -0,0 +1,78 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+bool BuildAndCheck(unsigned seed, uint64_t ranges)
+{
+    std::vector<uint64_t> order(ranges);
+    for (uint64_t i = 0; i < ranges; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(seed);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    UIT::Tree<uint64_t, uint64_t> map;
+    for (uint64_t i : order)
+    {
+        uint64_t value = i + seed;
+        map.Insert(i * 10, i * 10 + 5, value);
+    }
+    try
+    {
+        map.Verify("Test4 build");
+    }
+    catch (const UIT::InternalError&)
+    {
+        return false;
+    }
+    for (uint64_t i = 0; i < ranges; ++i)
+    {
+        if (map.Access(i * 10 + 4) != i + seed || map.Has(i * 10 + 5))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    unsigned threads = std::max(2u, std::thread::hardware_concurrency());
+    std::atomic<unsigned> failures(0);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([t, &failures]()
+        {
+            for (unsigned round = 0; round < 4; ++round)
+            {
+                if (!BuildAndCheck(t * 4 + round, 20000))
+                {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::cout << threads << " threads finished with " << failures << " failures\n";
+    if (failures)
+    {
+        std::cerr << "ERROR: independent trees were corrupted by concurrent insertion\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <set>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+using Node = UIT::Node<uint64_t, uint64_t>;
+
+void check(bool expr, const char* what, int step)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " after step " << step << "\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    UIT::Tree<uint64_t, uint64_t, UIT::PoolAllocator<Node, 64>> map;
+    std::set<uint64_t> reference;
+    std::mt19937_64 rng(7);
+
+    // Random insert/delete churn over a small key space so deletions hit every red-black case
+    for (int step = 0; step < 100000; ++step)
+    {
+        uint64_t key = rng() % 1000;
+        if (reference.count(key))
+        {
+            map.Delete(key * 10, key * 10 + 5);
+            reference.erase(key);
+        }
+        else
+        {
+            uint64_t value = key;
+            map.Insert(key * 10, key * 10 + 5, value);
+            reference.insert(key);
+        }
+        check(map.root == nullptr || (map.root->parent == nullptr && map.root->color == UIT::Color::BLACK),
+              "bad root", step);
+        map.Verify("Test5 step");
+        check(map.size() == reference.size(), "wrong size", step);
+        check(map.empty() || (map.begin()->range_start == *reference.begin() * 10 &&
+                              map.rbegin()->range_start == *reference.rbegin() * 10), "wrong ends", step);
+        uint64_t probe = rng() % 1000;
+        check(map.Has(probe * 10 + 4) == (reference.count(probe) == 1), "lookup mismatch", step);
+    }
+
+    std::cout << "Final tree:\n";
+    std::cout << map.ToString() << "\n";
+    return 0;
+}
@@ -0,0 +1,176 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+int64_t live_nodes = 0;
+int64_t live_values = 0;
+
+// Counts node allocations so leaks show up as a non-zero balance
+template <class T>
+class CountingAllocator : public std::allocator<T>
+{
+    public:
+        template <class U>
+        struct rebind
+        {
+            using other = CountingAllocator<U>;
+        };
+
+        CountingAllocator() = default;
+
+        template <class U>
+        CountingAllocator(const CountingAllocator<U>&) {}
+
+        T* allocate(std::size_t n)
+        {
+            live_nodes += n;
+            return std::allocator<T>::allocate(n);
+        }
+
+        void deallocate(T* ptr, std::size_t n)
+        {
+            live_nodes -= n;
+            std::allocator<T>::deallocate(ptr, n);
+        }
+};
+
+// Counts constructions and destructions of values
+struct Value
+{
+    std::string payload;
+
+    Value() : payload("value")
+    {
+        ++live_values;
+    }
+
+    Value(Value&& other) : payload(std::move(other.payload))
+    {
+        ++live_values;
+    }
+
+    ~Value()
+    {
+        --live_values;
+    }
+};
+
+void check(bool expr, const char* what)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << ", " << live_nodes << " nodes and " << live_values << " values alive\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    using Node = UIT::Node<uint64_t, Value>;
+    {
+        UIT::Tree<uint64_t, Value, CountingAllocator<Node>> map;
+        for (uint64_t i = 0; i < 10000; ++i)
+        {
+            Value value;
+            map.Insert(i * 2, i * 2 + 1, value);
+        }
+        check(live_nodes == 10000 && live_values == 10000, "wrong number of nodes after insertion");
+        map.Clear();
+        check(live_nodes == 0 && live_values == 0, "Clear leaked nodes");
+        check(map.root == nullptr && !map.Has(0), "Clear left nodes in the tree");
+
+        // The tree must be reusable after clearing
+        for (uint64_t i = 0; i < 1000; ++i)
+        {
+            map.Insert(i * 2, i * 2 + 1);
+        }
+        check(live_nodes == 1000 && live_values == 1000, "wrong number of nodes after reinsertion");
+    }
+    check(live_nodes == 0 && live_values == 0, "destructor leaked nodes");
+
+    // An owned pool is released in bulk, but value destructors still run
+    {
+        UIT::Tree<uint64_t, Value, UIT::PoolAllocator<Node>> map;
+        for (uint64_t i = 0; i < 10000; ++i)
+        {
+            map.Insert(i * 2, i * 2 + 1);
+        }
+        check(map.node_allocator.Owned() && map.node_allocator.Capacity() >= 10000, "pool did not grow");
+        map.Clear();
+        check(live_values == 0 && map.node_allocator.Capacity() == 0, "pool was not released");
+        map.Insert(0, 1);
+    }
+    check(live_values == 0, "pooled destructor leaked values");
+
+    // A shared pool must not be released while another tree still uses it
+    {
+        UIT::PoolAllocator<UIT::Node<uint64_t, uint64_t>> pool;
+        UIT::Tree<uint64_t, uint64_t, UIT::PoolAllocator<UIT::Node<uint64_t, uint64_t>>> first(pool);
+        UIT::Tree<uint64_t, uint64_t, UIT::PoolAllocator<UIT::Node<uint64_t, uint64_t>>> second(pool);
+        for (uint64_t i = 0; i < 100; ++i)
+        {
+            first.Insert(i * 2, i * 2 + 1);
+            second.Insert(i * 2, i * 2 + 1);
+        }
+        first.Clear();
+        check(pool.Capacity() > 0 && second.Has(198) && !first.Has(198), "shared pool was released");
+    }
+
+    // Moves and swaps hand over the nodes, clones copy them with the same shape
+    {
+        UIT::Tree<uint64_t, Value, CountingAllocator<Node>> source;
+        for (uint64_t i = 0; i < 1000; ++i)
+        {
+            source.Insert(i * 2, i * 2 + 1);
+        }
+        UIT::Tree<uint64_t, Value, CountingAllocator<Node>> moved(std::move(source));
+        check(source.root == nullptr && moved.Has(1998) && live_nodes == 1000, "move construction failed");
+        source.Insert(0, 1);
+
+        UIT::Tree<uint64_t, Value, CountingAllocator<Node>> assigned;
+        assigned.Insert(5000, 5001);
+        assigned = std::move(moved);
+        check(moved.root == nullptr && assigned.Has(1998) && !assigned.Has(5000) && live_nodes == 1001,
+              "move assignment failed");
+
+        swap(source, assigned);
+        check(source.Has(1998) && assigned.Has(0) && !assigned.Has(2), "swap failed");
+
+        std::vector<UIT::Tree<uint64_t, Value, CountingAllocator<Node>>> trees;
+        trees.push_back(std::move(source));
+        trees.push_back(std::move(assigned));
+        check(trees[0].Has(1998) && live_nodes == 1001, "trees cannot be stored in containers");
+    }
+    check(live_nodes == 0 && live_values == 0, "moved trees leaked nodes");
+
+    {
+        UIT::Tree<uint64_t, uint64_t, UIT::PoolAllocator<UIT::Node<uint64_t, uint64_t>>> source;
+        for (uint64_t i = 0; i < 1000; ++i)
+        {
+            uint64_t value = i;
+            source.Insert((i * 7919) % 1000 * 2, (i * 7919) % 1000 * 2 + 1, value);
+        }
+        auto clone = source.Clone();
+        check(clone.node_allocator != source.node_allocator, "clone shares its pool with the source");
+        check(clone.ToString(false) == source.ToString(false), "clone has a different shape");
+        check(clone.size() == source.size() && clone.begin()->range_start == 0 &&
+              clone.rbegin()->range_start == 1998, "clone has wrong ends");
+        source.Delete(0, 1);
+        check(clone.Has(0) && !source.Has(0), "clone shares nodes with the source");
+        for (auto it = clone.begin(); it != clone.end(); ++it)
+        {
+            check(it->parent == nullptr || it->parent->left_child == &*it || it->parent->right_child == &*it,
+                  "clone has broken parent links");
+        }
+    }
+
+    return 0;
+}
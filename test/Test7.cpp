@@ -0,0 +1,78 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <algorithm>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+#include "UniqueIntervalTree/Tree.hpp"
+
+using Range = std::tuple<uint64_t, uint64_t, uint64_t>;
+
+void check(bool expr, const char* what, uint64_t count)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " for " << count << " ranges\n";
+        exit(1);
+    }
+}
+
+template <class Exception>
+bool Throws(std::vector<Range> ranges)
+{
+    try
+    {
+        UIT::Tree<uint64_t, uint64_t> map(ranges.begin(), ranges.end());
+    }
+    catch (const Exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    for (uint64_t count = 0; count < 600; ++count)
+    {
+        std::vector<Range> ranges;
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            ranges.emplace_back(i * 10, i * 10 + 5 + i % 5, i);
+        }
+        UIT::Tree<uint64_t, uint64_t> map(ranges.begin(), ranges.end());
+        check(map.root == nullptr || map.root->color == UIT::Color::BLACK, "red root", count);
+        map.Verify("Test7 bulk load");
+        uint64_t i = 0;
+        for (auto it = map.begin(); it != map.end(); ++it, ++i)
+        {
+            check(it->range_start == i * 10 && it->range_value == i, "wrong order", count);
+        }
+        check(i == count && map.size() == count, "wrong number of nodes", count);
+        check(count == 0 || map.rbegin()->range_start == (count - 1) * 10, "wrong last node", count);
+
+        // Bulk loaded trees must keep working with regular insertions and deletions
+        if (count)
+        {
+            map.Delete(0, 5);
+            uint64_t value = 1;
+            map.Insert(count * 10, count * 10 + 1, value);
+            map.Verify("Test7 updates");
+            check(map.Has(count * 10) && !map.Has(0), "broken updates", count);
+        }
+    }
+
+    std::cout << "Bulk loaded tree:\n";
+    std::vector<Range> ranges = {Range(0, 10, 0), Range(10, 20, 1), Range(25, 30, 2), Range(40, 45, 3)};
+    UIT::Tree<uint64_t, uint64_t> map(ranges.begin(), ranges.end());
+    std::cout << map.ToString() << "\n";
+
+    check(Throws<UIT::RangeExists<uint64_t>>({Range(0, 10, 0), Range(5, 20, 1)}), "overlap not detected", 2);
+    check(Throws<UIT::UnsortedRanges<uint64_t>>({Range(10, 20, 0), Range(0, 5, 1)}), "disorder not detected", 2);
+    check(Throws<UIT::InvalidRangeException<uint64_t>>({Range(0, 10, 0), Range(20, 20, 1)}),
+          "empty range not detected", 2);
+    return 0;
+}
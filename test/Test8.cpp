@@ -0,0 +1,70 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <iostream>
+#include <random>
+
+#include "UniqueIntervalTree/Snapshot.hpp"
+
+void check(bool expr, const char* what, uint64_t point)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " at point " << point << "\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    std::mt19937_64 rng(3);
+    for (uint64_t count : {0, 1, 2, 3, 7, 8, 100, 1000, 4095})
+    {
+        UIT::Tree<uint64_t, uint64_t> map;
+        for (uint64_t i = 0; i < count * 4; ++i)
+        {
+            uint64_t key = rng() % (count * 4);
+            uint64_t value = key + 1;
+            if (!map.Has(key * 10, key * 10 + 10))
+            {
+                map.Insert(key * 10, key * 10 + 3 + key % 7, value);
+            }
+        }
+        UIT::Snapshot<uint64_t, uint64_t> snapshot(map);
+        check(snapshot.size() == map.size(), "wrong size", count);
+
+        for (uint64_t point = 0; point < count * 40 + 20; ++point)
+        {
+            const uint64_t* expected = nullptr;
+            const uint64_t* found = nullptr;
+            uint64_t expected_start = 0, expected_end = 0, found_start = 0, found_end = 0;
+            bool in_tree = map.Access(point, expected_start, expected_end, expected);
+            bool in_snapshot = snapshot.Access(point, found_start, found_end, found);
+            check(in_tree == in_snapshot && in_tree == snapshot.Has(point), "membership mismatch", point);
+            if (in_tree)
+            {
+                check(*expected == *found && expected_start == found_start && expected_end == found_end,
+                      "value mismatch", point);
+                check(snapshot.Access(point) == *expected, "throwing access mismatch", point);
+            }
+        }
+    }
+
+    UIT::Tree<uint64_t, uint64_t> map;
+    uint64_t value = 1;
+    map.Insert(10, 20, value);
+    UIT::Snapshot<uint64_t, uint64_t> snapshot(map);
+    map.Delete(10, 20);
+    check(snapshot.Has(15) && !map.Has(15), "snapshot follows the tree", 15);
+    try
+    {
+        snapshot.Access(25);
+        check(false, "missing point did not throw", 25);
+    }
+    catch (const UIT::PointNotFound<uint64_t>& e)
+    {
+        std::cout << e.what() << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Copyright(c) 2021-present, Mohammad Ewais & contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "UniqueIntervalTree/Finger.hpp"
+
+void check(bool expr, const char* what, uint64_t point)
+{
+    if (!expr)
+    {
+        std::cerr << "ERROR: " << what << " at point " << point << "\n";
+        exit(1);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "test started\n";
+    std::mt19937_64 rng(11);
+    UIT::Tree<uint64_t, uint64_t> map;
+    for (uint64_t i = 0; i < 5000; ++i)
+    {
+        uint64_t key = rng() % 10000;
+        uint64_t value = key;
+        if (!map.Has(key * 10, key * 10 + 10))
+        {
+            map.Insert(key * 10, key * 10 + 1 + key % 9, value);
+        }
+    }
+
+    // Batch lookups must agree with the single point lookups, including batches smaller than the lane count
+    for (std::size_t count : {0, 1, 5, 8, 9, 1000})
+    {
+        std::vector<uint64_t> points(count);
+        for (uint64_t& point : points)
+        {
+            point = rng() % 100010;
+        }
+        std::vector<uint64_t*> values(count);
+        std::vector<uint64_t> starts(count), ends(count);
+        std::vector<const uint64_t*> const_values(count);
+        std::unique_ptr<bool[]> has(new bool[count]);
+        std::size_t found = map.AccessBatch(points.data(), count, values.data(), starts.data(), ends.data());
+        const UIT::Tree<uint64_t, uint64_t>& const_map = map;
+        std::size_t const_found = const_map.AccessBatch(points.data(), count, const_values.data());
+        map.HasBatch(points.data(), count, has.get());
+
+        std::size_t expected_found = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            uint64_t* expected = nullptr;
+            uint64_t start = 0, end = 0;
+            bool hit = map.Access(points[i], start, end, expected);
+            expected_found += hit;
+            check(has[i] == hit && (values[i] != nullptr) == hit && (const_values[i] != nullptr) == hit,
+                  "batch membership mismatch", points[i]);
+            check(!hit || (values[i] == expected && const_values[i] == expected && starts[i] == start &&
+                           ends[i] == end), "batch result mismatch", points[i]);
+        }
+        check(found == expected_found && const_found == expected_found, "wrong number found", count);
+    }
+
+    // Fingers must agree with plain lookups on sorted, reversed and random streams, and survive deletions
+    UIT::Finger<UIT::Tree<uint64_t, uint64_t>> finger(map);
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        for (uint64_t i = 0; i < 100020; ++i)
+        {
+            uint64_t point = pass == 0? i : pass == 1? 100020 - i : rng() % 100020;
+            uint64_t* expected = nullptr;
+            uint64_t* found = nullptr;
+            uint64_t start = 0, end = 0, found_start = 0, found_end = 0;
+            bool hit = map.Access(point, start, end, expected);
+            check(finger.Access(point, found_start, found_end, found) == hit, "finger membership mismatch", point);
+            check(!hit || (found == expected && found_start == start && found_end == end), "finger result mismatch",
+                  point);
+            if (hit && i % 97 == 0)
+            {
+                map.Delete(start, end);
+                check(!finger.Has(point), "finger found a deleted range", point);
+            }
+        }
+    }
+
+    // A cached tree must agree with an uncached clone across hot lookups, deletions and resizes
+    UIT::Tree<uint64_t, uint64_t> cached = map.Clone();
+    cached.EnableCache(64, 6);
+    for (uint64_t i = 0; i < 200000; ++i)
+    {
+        uint64_t point = i % 3? rng() % 2000 : rng() % 100020;
+        uint64_t start = 0, end = 0, cached_start = 0, cached_end = 0;
+        uint64_t* expected = nullptr;
+        uint64_t* found = nullptr;
+        bool hit = map.Access(point, start, end, expected);
+        check(cached.Access(point, cached_start, cached_end, found) == hit, "cache membership mismatch", point);
+        check(!hit || (*found == *expected && cached_start == start && cached_end == end), "cache result mismatch",
+              point);
+        if (hit && i % 89 == 0)
+        {
+            map.Delete(start, end);
+            cached.Delete(start, end);
+            check(!cached.Has(point), "cache found a deleted range", point);
+        }
+        else if (hit && i % 53 == 0 && end - start > 1)
+        {
+            map.ShrinkEnd(start, end, end - 1);
+            cached.ShrinkEnd(start, end, end - 1);
+        }
+    }
+    check(cached.CacheHits() > 0 && cached.CacheMisses() > 0, "cache statistics not updated", 0);
+    return 0;
+}